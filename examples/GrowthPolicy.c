@@ -0,0 +1,268 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Compares the reallocation behavior of vectors with different growth and shrink settings.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <time.h>
+#include <Zycore/Defines.h>
+#include <Zycore/LibC.h>
+#include <Zycore/StatsAllocator.h>
+#include <Zycore/Types.h>
+#include <Zycore/Vector.h>
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `Configuration` struct that describes the growth settings of a benchmark run.
+ */
+typedef struct Configuration_
+{
+    /**
+     * The name of the configuration.
+     */
+    const char* name;
+    /**
+     * The integral growth factor.
+     */
+    ZyanU8 growth_factor;
+    /**
+     * The integral shrink threshold.
+     */
+    ZyanU8 shrink_threshold;
+    /**
+     * The growth policy or `ZYAN_NULL`.
+     */
+    const ZyanVectorGrowthPolicy* policy;
+} Configuration;
+
+/**
+ * Defines the `Workload` function prototype.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ *
+ * @return  A zyan status code.
+ */
+typedef ZyanStatus (*Workload)(ZyanVector* vector);
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * Returns the next value of a simple linear congruential generator.
+ *
+ * A fixed generator is used instead of `rand`, to run every configuration with the exact same
+ * sequence of operations.
+ *
+ * @param   state   A pointer to the generator state.
+ *
+ * @return  The next pseudo-random value.
+ */
+static ZyanU32 NextRandom(ZyanU64* state)
+{
+    ZYAN_ASSERT(state);
+
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (ZyanU32)(*state >> 33);
+}
+
+/* ============================================================================================== */
+/* Workloads                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * Appends a large number of elements.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus WorkloadFill(ZyanVector* vector)
+{
+    for (ZyanU32 i = 0; i < (1 << 20); ++i)
+    {
+        ZYAN_CHECK(ZyanVectorPushBack(vector, &i));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Repeatedly fills and drains the vector, like a work queue that processes batches.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus WorkloadBurst(ZyanVector* vector)
+{
+    for (ZyanU32 round = 0; round < 64; ++round)
+    {
+        for (ZyanU32 i = 0; i < (1 << 14); ++i)
+        {
+            ZYAN_CHECK(ZyanVectorPushBack(vector, &i));
+        }
+        for (ZyanU32 i = 0; i < (1 << 14); ++i)
+        {
+            ZYAN_CHECK(ZyanVectorPopBack(vector));
+        }
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Randomly pushes and pops small batches of elements, like a queue whose size oscillates around
+ * a steady state.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus WorkloadJitter(ZyanVector* vector)
+{
+    ZyanU64 state = 0x5EED;
+    for (ZyanU32 i = 0; i < (1 << 20); ++i)
+    {
+        const ZyanU32 value = NextRandom(&state);
+        const ZyanU32 count = 1 + (value & 3);
+        if ((value & 4) || (vector->size < count))
+        {
+            for (ZyanU32 j = 0; (j < count) && (vector->size < (1 << 13)); ++j)
+            {
+                ZYAN_CHECK(ZyanVectorPushBack(vector, &value));
+            }
+        } else
+        {
+            for (ZyanU32 j = 0; j < count; ++j)
+            {
+                ZYAN_CHECK(ZyanVectorPopBack(vector));
+            }
+        }
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ============================================================================================== */
+/* Benchmark                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * Runs a single workload with the given configuration and prints the results.
+ *
+ * @param   name            The name of the workload.
+ * @param   workload        The workload function.
+ * @param   configuration   A pointer to the `Configuration` struct.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus Run(const char* name, Workload workload, const Configuration* configuration)
+{
+    ZyanStatsAllocator stats;
+    ZYAN_CHECK(ZyanStatsAllocatorInit(&stats));
+
+    ZyanVector vector;
+    ZYAN_CHECK(ZyanVectorInitEx(&vector, sizeof(ZyanU32), 0, ZYAN_NULL, &stats.allocator,
+        configuration->growth_factor, configuration->shrink_threshold));
+    ZYAN_CHECK(ZyanVectorSetGrowthPolicy(&vector, configuration->policy));
+
+    const clock_t start = clock();
+    ZYAN_CHECK(workload(&vector));
+    const clock_t end = clock();
+
+    ZyanStatsAllocatorSnapshot snapshot;
+    ZYAN_CHECK(ZyanStatsAllocatorGetSnapshot(&stats, &snapshot));
+    ZYAN_CHECK(ZyanVectorDestroy(&vector));
+
+    printf("%-8s %-28s %14" PRIu64 " %12" PRIu64 " %10.2f\n", name, configuration->name,
+        snapshot.reallocations, snapshot.peak_bytes / 1024,
+        (double)(end - start) * 1000.0 / CLOCKS_PER_SEC);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(void)
+{
+    ZyanVectorGrowthPolicy eager;
+    ZyanVectorGrowthPolicyInit(&eager);
+    eager.shrink_threshold = 2;
+    eager.shrink_delay     = 0;
+
+    ZyanVectorGrowthPolicy hysteresis;
+    ZyanVectorGrowthPolicyInit(&hysteresis);
+    hysteresis.shrink_threshold = 2;
+
+    ZyanVectorGrowthPolicy standard;
+    ZyanVectorGrowthPolicyInit(&standard);
+
+    const Configuration configurations[] =
+    {
+        { "factor 2, threshold 4"     , 2, 4, ZYAN_NULL   },
+        { "factor 2, threshold 2"     , 2, 2, ZYAN_NULL   },
+        { "policy 1.5x, threshold 2"  , 1, 0, &eager      },
+        { "policy 1.5x, threshold 2+h", 1, 0, &hysteresis },
+        { "policy default"            , 1, 0, &standard   }
+    };
+    static const struct
+    {
+        const char* name;
+        Workload workload;
+    } workloads[] =
+    {
+        { "fill"  , &WorkloadFill   },
+        { "burst" , &WorkloadBurst  },
+        { "jitter", &WorkloadJitter }
+    };
+
+    printf("%-8s %-28s %14s %12s %10s\n", "workload", "configuration", "reallocations",
+        "peak (KiB)", "time (ms)");
+    for (ZyanUSize i = 0; i < ZYAN_ARRAY_LENGTH(workloads); ++i)
+    {
+        for (ZyanUSize j = 0; j < ZYAN_ARRAY_LENGTH(configurations); ++j)
+        {
+            if (!ZYAN_SUCCESS(Run(workloads[i].name, workloads[i].workload, &configurations[j])))
+            {
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* ============================================================================================== */
@@ -46,6 +46,10 @@
 #   error "Unsupported platform detected"
 #endif
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /* ============================================================================================== */
 /* Enums and types                                                                                */
 /* ============================================================================================== */
@@ -93,7 +97,8 @@ ZYCORE_EXPORT ZyanU32 ZyanMemoryGetSystemPageSize(void);
  * Returns the system allocation granularity.
  *
  * The system allocation granularity specifies the minimum amount of bytes which can be allocated
- * at a specific address by a single call of `ZyanMemoryVirtualAlloc`.
+ * at a specific address by a single call of `ZyanMemoryVirtualReserve` or
+ * `ZyanMemoryVirtualAllocate`.
  *
  * This value is typically 64KiB on Windows systems and equal to the page size on most POSIX
  * platforms.
@@ -102,10 +107,99 @@ ZYCORE_EXPORT ZyanU32 ZyanMemoryGetSystemPageSize(void);
  */
 ZYCORE_EXPORT ZyanU32 ZyanMemoryGetSystemAllocationGranularity(void);
 
+/**
+ * Returns the system large page size.
+ *
+ * On Windows this is the minimum large page size reported by the system. On Linux this is the
+ * transparent huge page size or, if transparent huge pages are not available, the default
+ * `hugetlbfs` page size. The value is determined once and cached.
+ *
+ * @return  The system large page size or `0`, if large pages are not supported.
+ */
+ZYCORE_EXPORT ZyanUSize ZyanMemoryGetLargePageSize(void);
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Memory management                                                                              */
 /* ---------------------------------------------------------------------------------------------- */
 
+/**
+ * Reserves and commits one or more memory pages.
+ *
+ * @param   address     Receives the start address of the allocated pages.
+ * @param   size        The size. Rounded up to a multiple of the page size by the system.
+ * @param   protection  The initial page protection value.
+ *
+ * @return  A zyan status code.
+ *
+ * Use `ZyanMemoryVirtualFree` to release the pages.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanMemoryVirtualAllocate(void** address, ZyanUSize size,
+    ZyanMemoryPageProtection protection);
+
+/**
+ * Reserves and commits one or more memory pages, preferably backed by large pages.
+ *
+ * @param   address     Receives the start address of the allocated pages.
+ * @param   size        A pointer to the requested size. Receives the actual size of the
+ *                      allocation, which is rounded up to a multiple of the large page size.
+ * @param   protection  The initial page protection value.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the allocation is backed by explicit large pages,
+ *          `ZYAN_STATUS_FALSE`, if the function fell back to normal pages or another zyan status
+ *          code, if an error occured.
+ *
+ * Explicit large pages (`MEM_LARGE_PAGES` on Windows, `MAP_HUGETLB` on Linux) are only available
+ * if the system administrator configured them. On Linux, the fallback allocation is aligned to
+ * the large page size and marked with `MADV_HUGEPAGE`, which allows the kernel to back it with
+ * transparent huge pages.
+ *
+ * Use `ZyanMemoryVirtualFree` with the size returned in `size` to release the pages.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanMemoryVirtualAllocateLarge(void** address, ZyanUSize* size,
+    ZyanMemoryPageProtection protection);
+
+/**
+ * Reserves a range of virtual address space without committing any physical memory.
+ *
+ * @param   address Receives the start address of the reserved range.
+ * @param   size    The size. Rounded up to a multiple of the allocation granularity by the
+ *                  system.
+ *
+ * @return  A zyan status code.
+ *
+ * The reserved pages are inaccessible until they are committed using `ZyanMemoryVirtualCommit`.
+ * Use `ZyanMemoryVirtualFree` to release the whole range.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanMemoryVirtualReserve(void** address, ZyanUSize size);
+
+/**
+ * Commits one or more pages inside a range previously reserved by `ZyanMemoryVirtualReserve`.
+ *
+ * @param   address     The start address aligned to a page boundary.
+ * @param   size        The size.
+ * @param   protection  The page protection value of the committed pages.
+ *
+ * @return  A zyan status code.
+ *
+ * Committed pages are zero-initialized. Physical memory is assigned lazily by the system on
+ * first access.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanMemoryVirtualCommit(void* address, ZyanUSize size,
+    ZyanMemoryPageProtection protection);
+
+/**
+ * Decommits one or more pages inside a range previously reserved by `ZyanMemoryVirtualReserve`.
+ *
+ * @param   address The start address aligned to a page boundary.
+ * @param   size    The size.
+ *
+ * @return  A zyan status code.
+ *
+ * The physical memory backing the pages is returned to the system, while the address range
+ * stays reserved. The pages become inaccessible until they are committed again.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanMemoryVirtualDecommit(void* address, ZyanUSize size);
+
 /**
  * Changes the memory protection value of one or more pages.
  *
@@ -132,6 +226,10 @@ ZYCORE_EXPORT ZyanStatus ZyanMemoryVirtualFree(void* address, ZyanUSize size);
 
 /* ============================================================================================== */
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* ZYAN_NO_LIBC */
 
 #endif /* ZYCORE_API_MEMORY_H */
@@ -137,6 +137,19 @@ typedef PFLS_CALLBACK_FUNCTION ZyanThreadTlsCallback;
 #   error "Unsupported platform detected"
 #endif
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Thread procedure                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Defines the `ZyanThreadProcedure` function prototype.
+ *
+ * @param   argument    The argument that was passed to `ZyanThreadCreate`.
+ */
+typedef void (*ZyanThreadProcedure)(void* argument);
+
+/* ---------------------------------------------------------------------------------------------- */
+
 /* ============================================================================================== */
 /* Exported functions                                                                             */
 /* ============================================================================================== */
@@ -163,6 +176,38 @@ ZYCORE_EXPORT ZyanStatus ZyanThreadGetCurrentThread(ZyanThread* thread);
  */
 ZYCORE_EXPORT ZyanStatus ZyanThreadGetCurrentThreadId(ZyanThreadId* thread_id);
 
+/**
+ * Creates a new thread.
+ *
+ * @param   thread      Receives the handle of the new thread.
+ * @param   procedure   The procedure to execute on the new thread.
+ * @param   argument    The argument to pass to the `procedure`.
+ *
+ * @return  A zyan status code.
+ *
+ * Every thread created by this function has to be joined using `ZyanThreadJoin`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanThreadCreate(ZyanThread* thread, ZyanThreadProcedure procedure,
+    void* argument);
+
+/**
+ * Waits for the given thread to finish and releases its resources.
+ *
+ * @param   thread  The handle of the thread.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanThreadJoin(ZyanThread thread);
+
+/**
+ * Returns the number of processors that are currently online.
+ *
+ * @param   count   Receives the number of processors.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanThreadGetProcessorCount(ZyanU32* count);
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Thread Local Storage (TLS)                                                                     */
 /* ---------------------------------------------------------------------------------------------- */
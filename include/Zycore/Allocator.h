@@ -39,6 +39,15 @@
 extern "C" {
 #endif
 
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The largest alignment (in bytes) supported by `ZyanAllocatorDefaultAligned`.
+ */
+#define ZYAN_ALLOCATOR_MAX_DEFAULT_ALIGNMENT    4096
+
 /* ============================================================================================== */
 /* Enums and types                                                                                */
 /* ============================================================================================== */
@@ -77,6 +86,24 @@ typedef ZyanStatus (*ZyanAllocatorAllocate)(struct ZyanAllocator_* allocator, vo
 typedef ZyanStatus (*ZyanAllocatorDeallocate)(struct ZyanAllocator_* allocator, void* p,
     ZyanUSize element_size, ZyanUSize n);
 
+/**
+ * Defines the `ZyanAllocatorExpand` function prototype.
+ *
+ * @param   allocator       A pointer to the `ZyanAllocator` instance.
+ * @param   p               The pointer obtained from `(re-)allocate()`.
+ * @param   element_size    The size of a single element.
+ * @param   n               The new number of elements.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the memory block is now able to hold `n` elements,
+ *          `ZYAN_STATUS_FALSE`, if the memory block can not be grown in place, or another zyan
+ *          status code, if an error occurred.
+ *
+ * Unlike `reallocate()`, this function never moves the memory block. The block remains unchanged,
+ * if `ZYAN_STATUS_FALSE` is returned.
+ */
+typedef ZyanStatus (*ZyanAllocatorExpand)(struct ZyanAllocator_* allocator, void* p,
+    ZyanUSize element_size, ZyanUSize n);
+
 /**
  * Defines the `ZyanAllocator` struct.
  *
@@ -99,8 +126,79 @@ typedef struct ZyanAllocator_
      * The deallocate function.
      */
     ZyanAllocatorDeallocate deallocate;
+    /**
+     * The (optional) in-place expand function or `ZYAN_NULL`, if not supported.
+     */
+    ZyanAllocatorExpand expand;
 } ZyanAllocator;
 
+/**
+ * Defines the `ZyanAlignedAllocator` struct.
+ *
+ * The aligned allocator wraps a backing allocator and guarantees that all returned memory blocks
+ * are aligned to a fixed power-of-two boundary. Each block is over-allocated by the alignment
+ * and prefixed with a small header, so `reallocate()` can still be forwarded to the backing
+ * allocator (the data is moved inside the block, if the alignment offset changes).
+ *
+ * Pass a pointer to the `allocator` field to any of the `*InitEx` functions to obtain aligned
+ * storage for a container instance.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanAlignedAllocator_
+{
+    /**
+     * The base allocator.
+     */
+    ZyanAllocator allocator;
+    /**
+     * The backing allocator.
+     */
+    ZyanAllocator* backing;
+    /**
+     * The alignment (in bytes).
+     */
+    ZyanUSize alignment;
+} ZyanAlignedAllocator;
+
+/**
+ * Defines the `ZyanSmallBufferAllocator` struct.
+ *
+ * The small buffer allocator hands out a single caller-provided inline buffer for the first
+ * request that fits into it and forwards all other requests to a backing allocator. Reallocating
+ * the inline buffer beyond its capacity transparently migrates the contents to a memory block
+ * obtained from the backing allocator.
+ *
+ * This allows containers to avoid any allocator round trip as long as they stay small.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanSmallBufferAllocator_
+{
+    /**
+     * The base allocator.
+     */
+    ZyanAllocator allocator;
+    /**
+     * The backing allocator.
+     */
+    ZyanAllocator* backing;
+    /**
+     * A pointer to the inline buffer.
+     */
+    void* buffer;
+    /**
+     * The size of the inline buffer (in bytes).
+     */
+    ZyanUSize capacity;
+    /**
+     * Signals, if the inline buffer is currently handed out.
+     */
+    ZyanBool in_use;
+} ZyanSmallBufferAllocator;
+
 /* ============================================================================================== */
 /* Exported functions                                                                             */
 /* ============================================================================================== */
@@ -114,10 +212,63 @@ typedef struct ZyanAllocator_
  * @param   deallocate  The deallocate function.
  *
  * @return  A zyan status code.
+ *
+ * The allocator does not support in-place expansion. Use `ZyanAllocatorInitEx` to provide an
+ * `expand` function.
  */
 ZYCORE_EXPORT ZyanStatus ZyanAllocatorInit(ZyanAllocator* allocator, ZyanAllocatorAllocate allocate,
     ZyanAllocatorAllocate reallocate, ZyanAllocatorDeallocate deallocate);
 
+/**
+ * Initializes the given `ZyanAllocator` instance and sets an optional in-place `expand` function.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   allocate    The allocate function.
+ * @param   reallocate  The reallocate function.
+ * @param   deallocate  The deallocate function.
+ * @param   expand      The in-place expand function or `ZYAN_NULL`, if not supported.
+ *
+ * @return  A zyan status code.
+ *
+ * Containers try to grow their storage using `expand` first and only fall back to `reallocate`,
+ * if the memory block can not be grown in place.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanAllocatorInitEx(ZyanAllocator* allocator,
+    ZyanAllocatorAllocate allocate, ZyanAllocatorAllocate reallocate,
+    ZyanAllocatorDeallocate deallocate, ZyanAllocatorExpand expand);
+
+/**
+ * Initializes the given `ZyanAlignedAllocator` instance.
+ *
+ * @param   allocator   A pointer to the `ZyanAlignedAllocator` instance.
+ * @param   alignment   The alignment (in bytes). Must be a power of two.
+ * @param   backing     A pointer to the `ZyanAllocator` instance all requests are forwarded to.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization is not required for instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanAlignedAllocatorInit(ZyanAlignedAllocator* allocator,
+    ZyanUSize alignment, ZyanAllocator* backing);
+
+/**
+ * Initializes the given `ZyanSmallBufferAllocator` instance.
+ *
+ * @param   allocator   A pointer to the `ZyanSmallBufferAllocator` instance.
+ * @param   buffer      A pointer to the inline buffer.
+ * @param   capacity    The size of the inline buffer (in bytes).
+ * @param   backing     A pointer to the `ZyanAllocator` instance used for all requests that do
+ *                      not fit into the inline buffer.
+ *
+ * @return  A zyan status code.
+ *
+ * The inline buffer must stay valid for the lifetime of the allocator.
+ *
+ * Finalization is not required for instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSmallBufferAllocatorInit(ZyanSmallBufferAllocator* allocator,
+    void* buffer, ZyanUSize capacity, ZyanAllocator* backing);
+
 #ifndef ZYAN_NO_LIBC
 
 /**
@@ -131,6 +282,35 @@ ZYCORE_EXPORT ZyanStatus ZyanAllocatorInit(ZyanAllocator* allocator, ZyanAllocat
  */
 ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanAllocator* ZyanAllocatorDefault(void);
 
+/**
+ * Returns a `ZyanAllocator` instance that allocates memory with the given alignment.
+ *
+ * @param   alignment   The alignment (in bytes). Must be a power of two not larger than
+ *                      `ZYAN_ALLOCATOR_MAX_DEFAULT_ALIGNMENT`.
+ *
+ * @return  A pointer to the aligned `ZyanAllocator` instance or `ZYAN_NULL`, if the alignment is
+ *          not supported.
+ *
+ * The returned allocator is a `ZyanAlignedAllocator` backed by the default allocator.
+ *
+ * You should in no case modify the returned allocator instance to avoid unexpected behavior.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanAllocator* ZyanAllocatorDefaultAligned(ZyanUSize alignment);
+
+/**
+ * Returns a `ZyanAllocator` instance that allocates memory backed by large pages.
+ *
+ * @return  A pointer to the large page `ZyanAllocator` instance.
+ *
+ * Every memory block is allocated using `ZyanMemoryVirtualAllocateLarge` and occupies at least one
+ * large page, which reduces TLB misses for big buffers like instruction caches or bitsets.
+ * Use the default allocator for small or short-lived memory blocks instead. If large pages are
+ * not available, the allocator falls back to normal pages.
+ *
+ * You should in no case modify the returned allocator instance to avoid unexpected behavior.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanAllocator* ZyanAllocatorLargePage(void);
+
 #endif // ZYAN_NO_LIBC
 
 /* ============================================================================================== */
@@ -0,0 +1,218 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements an arena (bump-pointer) allocator.
+ */
+
+#ifndef ZYCORE_ARENA_ALLOCATOR_H
+#define ZYCORE_ARENA_ALLOCATOR_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The default size (in bytes) of the chunks requested from the backing allocator.
+ */
+#define ZYAN_ARENA_DEFAULT_CHUNK_SIZE   (64 * 1024)
+
+/**
+ * The alignment (in bytes) of all memory blocks returned by the arena allocator.
+ */
+#define ZYAN_ARENA_ALIGNMENT            (2 * sizeof(void*))
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanArenaChunk` struct.
+ *
+ * The chunk header is directly followed by the usable chunk memory.
+ */
+typedef struct ZyanArenaChunk_
+{
+    /**
+     * A pointer to the next chunk.
+     */
+    struct ZyanArenaChunk_* next;
+    /**
+     * The number of usable bytes following the chunk header.
+     */
+    ZyanUSize capacity;
+} ZyanArenaChunk;
+
+/**
+ * Defines the `ZyanArenaAllocator` struct.
+ *
+ * The arena allocator carves memory blocks out of large chunks obtained from a backing allocator.
+ * Deallocation of individual blocks is a no-op; all blocks are released at once by either
+ * `ZyanArenaReset` or `ZyanArenaDestroy`.
+ *
+ * Pass a pointer to the `allocator` field to any of the `*InitEx` functions to use the arena for
+ * a container instance.
+ *
+ * All other fields in this struct should be considered as "private". Any changes may lead to
+ * unexpected behavior.
+ */
+typedef struct ZyanArenaAllocator_
+{
+    /**
+     * The base allocator.
+     */
+    ZyanAllocator allocator;
+    /**
+     * The backing allocator used to obtain new chunks or `ZYAN_NULL`, if the arena uses a
+     * custom user defined buffer.
+     */
+    ZyanAllocator* backing;
+    /**
+     * The minimum size of a new chunk (in bytes).
+     */
+    ZyanUSize chunk_size;
+    /**
+     * The head of the chunk list.
+     */
+    ZyanArenaChunk* head;
+    /**
+     * The chunk currently used for allocations or `ZYAN_NULL`, if no chunk was used since the
+     * last reset.
+     */
+    ZyanArenaChunk* current;
+    /**
+     * The number of bytes already used in the current chunk.
+     */
+    ZyanUSize offset;
+    /**
+     * The most recently allocated block or `ZYAN_NULL`, if none.
+     */
+    void* last;
+} ZyanArenaAllocator;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanArenaAllocator` instance.
+ *
+ * @param   arena       A pointer to the `ZyanArenaAllocator` instance.
+ * @param   chunk_size  The minimum size of the chunks (in bytes) or `0` to use the default size.
+ *
+ * @return  A zyan status code.
+ *
+ * The chunks are obtained from the default allocator.
+ *
+ * Finalization with `ZyanArenaDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanArenaInit(ZyanArenaAllocator* arena,
+    ZyanUSize chunk_size);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanArenaAllocator` instance and sets a custom backing `allocator`.
+ *
+ * @param   arena       A pointer to the `ZyanArenaAllocator` instance.
+ * @param   chunk_size  The minimum size of the chunks (in bytes) or `0` to use the default size.
+ * @param   backing     A pointer to the `ZyanAllocator` instance used to obtain new chunks.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanArenaDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanArenaInitEx(ZyanArenaAllocator* arena, ZyanUSize chunk_size,
+    ZyanAllocator* backing);
+
+/**
+ * Initializes the given `ZyanArenaAllocator` instance and configures it to use a custom user
+ * defined buffer with a fixed size.
+ *
+ * @param   arena       A pointer to the `ZyanArenaAllocator` instance.
+ * @param   buffer      A pointer to the buffer that is used as the only chunk.
+ * @param   capacity    The size of the buffer (in bytes).
+ *
+ * @return  A zyan status code.
+ *
+ * Allocations fail with `ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE` once the buffer is exhausted.
+ *
+ * Finalization is not required for instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanArenaInitCustomBuffer(ZyanArenaAllocator* arena, void* buffer,
+    ZyanUSize capacity);
+
+/**
+ * Destroys the given `ZyanArenaAllocator` instance and releases all chunks.
+ *
+ * @param   arena   A pointer to the `ZyanArenaAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * All memory blocks previously obtained from the arena become invalid.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanArenaDestroy(ZyanArenaAllocator* arena);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Releases all memory blocks of the given arena at once.
+ *
+ * @param   arena   A pointer to the `ZyanArenaAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * The chunks are kept and reused by subsequent allocations. All memory blocks previously obtained
+ * from the arena become invalid.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanArenaReset(ZyanArenaAllocator* arena);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_ARENA_ALLOCATOR_H */
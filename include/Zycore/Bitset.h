@@ -474,6 +474,52 @@ ZYCORE_EXPORT ZyanStatus ZyanBitsetNone(const ZyanBitset* bitset);
 
 /* ---------------------------------------------------------------------------------------------- */
 
+/* ============================================================================================== */
+/* Inline fast paths                                                                              */
+/* ============================================================================================== */
+
+#ifdef ZYCORE_INLINE_FASTPATH
+
+/*
+ * With `ZYCORE_INLINE_FASTPATH` defined, calls to the trivial accessors are replaced by the inline
+ * implementations below. See `Vector.h` for details.
+ */
+
+ZYAN_INLINE ZyanStatus ZyanBitsetTestInline(ZyanBitset* bitset, ZyanUSize index)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= bitset->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    const ZyanU8 value = ((const ZyanU8*)bitset->bits.data)[index / 8];
+
+    return (value & (1 << (7 - (index % 8)))) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+ZYAN_INLINE ZyanStatus ZyanBitsetGetSizeInline(const ZyanBitset* bitset, ZyanUSize* size)
+{
+    if (!bitset)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = bitset->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+#define ZyanBitsetTest(bitset, index) \
+    ZyanBitsetTestInline(bitset, index)
+#define ZyanBitsetGetSize(bitset, size) \
+    ZyanBitsetGetSizeInline(bitset, size)
+
+#endif // ZYCORE_INLINE_FASTPATH
+
 /* ============================================================================================== */
 
 #ifdef __cplusplus
@@ -0,0 +1,379 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements the double-ended queue container class.
+ */
+
+#ifndef ZYCORE_DEQUE_H
+#define ZYCORE_DEQUE_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Object.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The initial minimum capacity (number of elements) for all deque instances.
+ */
+#define ZYAN_DEQUE_MIN_CAPACITY                 1
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanDeque` struct.
+ *
+ * A deque stores its elements in a ring buffer with a power-of-two capacity. Elements can be
+ * added and removed at both ends in constant time. When the ring buffer is full, it is replaced
+ * by a buffer of twice the capacity.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanDeque_
+{
+    /**
+     * The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The current number of elements in the deque.
+     */
+    ZyanUSize size;
+    /**
+     * The capacity (number of elements) of the ring buffer. This is always a power of two.
+     */
+    ZyanUSize capacity;
+    /**
+     * The position of the first element in the ring buffer.
+     */
+    ZyanUSize head;
+    /**
+     * The size of a single element in bytes.
+     */
+    ZyanUSize element_size;
+    /**
+     * The element destructor callback.
+     */
+    ZyanMemberProcedure destructor;
+    /**
+     * The data pointer.
+     */
+    void* data;
+} ZyanDeque;
+
+/* ============================================================================================== */
+/* Macros                                                                                         */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* General                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Defines an uninitialized `ZyanDeque` instance.
+ */
+#define ZYAN_DEQUE_INITIALIZER \
+    { \
+        /* allocator        */ ZYAN_NULL, \
+        /* size             */ 0, \
+        /* capacity         */ 0, \
+        /* head             */ 0, \
+        /* element_size     */ 0, \
+        /* destructor       */ ZYAN_NULL, \
+        /* data             */ ZYAN_NULL \
+    }
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper macros                                                                                  */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the value of the element at the given `index`.
+ *
+ * @param   type    The desired value type.
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   index   The element index, counted from the front of the deque.
+ *
+ * @result  The value of the desired element in the deque.
+ *
+ * Note that this function is unsafe and might dereference a null-pointer.
+ */
+#ifdef __cplusplus
+#define ZYAN_DEQUE_GET(type, deque, index) \
+    (*reinterpret_cast<const type*>(ZyanDequeGet(deque, index)))
+#else
+#define ZYAN_DEQUE_GET(type, deque, index) \
+    (*(const type*)ZyanDequeGet(deque, index))
+#endif
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanDeque` instance.
+ *
+ * @param   deque           A pointer to the `ZyanDeque` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   capacity        The initial capacity (number of elements). This value is rounded up
+ *                          to the next power of two.
+ * @param   destructor      A destructor callback that is invoked every time an item is deleted, or
+ *                          `ZYAN_NULL` if not needed.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the deque elements is dynamically allocated by the default allocator.
+ *
+ * Finalization with `ZyanDequeDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanDequeInit(ZyanDeque* deque,
+    ZyanUSize element_size, ZyanUSize capacity, ZyanMemberProcedure destructor);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanDeque` instance and sets a custom `allocator`.
+ *
+ * @param   deque           A pointer to the `ZyanDeque` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   capacity        The initial capacity (number of elements). This value is rounded up
+ *                          to the next power of two.
+ * @param   destructor      A destructor callback that is invoked every time an item is deleted, or
+ *                          `ZYAN_NULL` if not needed.
+ * @param   allocator       A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanDequeDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequeInitEx(ZyanDeque* deque, ZyanUSize element_size,
+    ZyanUSize capacity, ZyanMemberProcedure destructor, ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanDeque` instance.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequeDestroy(ZyanDeque* deque);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Element access                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns a constant pointer to the element at the given `index`.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   index   The element index, counted from the front of the deque.
+ *
+ * @return  A constant pointer to the desired element in the deque or `ZYAN_NULL`, if an error
+ *          occurred.
+ *
+ * Note that the returned pointer might get invalid when the deque grows or elements are removed.
+ */
+ZYCORE_EXPORT const void* ZyanDequeGet(const ZyanDeque* deque, ZyanUSize index);
+
+/**
+ * Returns a mutable pointer to the element at the given `index`.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   index   The element index, counted from the front of the deque.
+ *
+ * @return  A mutable pointer to the desired element in the deque or `ZYAN_NULL`, if an error
+ *          occurred.
+ *
+ * Note that the returned pointer might get invalid when the deque grows or elements are removed.
+ */
+ZYCORE_EXPORT void* ZyanDequeGetMutable(const ZyanDeque* deque, ZyanUSize index);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Adds a new `element` to the end of the deque.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   element A pointer to the element to add.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequePushBack(ZyanDeque* deque, const void* element);
+
+/**
+ * Adds a new `element` to the front of the deque.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   element A pointer to the element to add.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequePushFront(ZyanDeque* deque, const void* element);
+
+/**
+ * Adds multiple `elements` to the end of the deque.
+ *
+ * @param   deque       A pointer to the `ZyanDeque` instance.
+ * @param   elements    A pointer to the first element of a contiguous array.
+ * @param   count       The number of elements to add.
+ *
+ * @return  A zyan status code.
+ *
+ * The elements are copied with at most two `memcpy` operations.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequePushBackRange(ZyanDeque* deque, const void* elements,
+    ZyanUSize count);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Removes the last element of the deque.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   element Receives the removed element or `ZYAN_NULL`, if not needed.
+ *
+ * @return  A zyan status code.
+ *
+ * If `element` is not `ZYAN_NULL`, the element is moved to it and the destructor is not invoked.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequePopBack(ZyanDeque* deque, void* element);
+
+/**
+ * Removes the first element of the deque.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   element Receives the removed element or `ZYAN_NULL`, if not needed.
+ *
+ * @return  A zyan status code.
+ *
+ * If `element` is not `ZYAN_NULL`, the element is moved to it and the destructor is not invoked.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequePopFront(ZyanDeque* deque, void* element);
+
+/**
+ * Removes multiple elements from the front of the deque.
+ *
+ * @param   deque       A pointer to the `ZyanDeque` instance.
+ * @param   elements    Receives the removed elements as a contiguous array or `ZYAN_NULL`, if not
+ *                      needed.
+ * @param   count       The number of elements to remove.
+ *
+ * @return  A zyan status code.
+ *
+ * If `elements` is not `ZYAN_NULL`, the elements are moved to it with at most two `memcpy`
+ * operations and the destructor is not invoked.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequePopFrontRange(ZyanDeque* deque, void* elements,
+    ZyanUSize count);
+
+/**
+ * Erases all elements of the given deque.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequeClear(ZyanDeque* deque);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Changes the capacity of the given `ZyanDeque` instance.
+ *
+ * @param   deque       A pointer to the `ZyanDeque` instance.
+ * @param   capacity    The new minimum capacity of the deque. This value is rounded up to the
+ *                      next power of two.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequeReserve(ZyanDeque* deque, ZyanUSize capacity);
+
+/**
+ * Shrinks the capacity of the given deque to the smallest power of two that fits its size.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequeShrinkToFit(ZyanDeque* deque);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the current capacity of the deque.
+ *
+ * @param   deque       A pointer to the `ZyanDeque` instance.
+ * @param   capacity    Receives the capacity of the deque.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequeGetCapacity(const ZyanDeque* deque, ZyanUSize* capacity);
+
+/**
+ * Returns the current size of the deque.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   size    Receives the size of the deque.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanDequeGetSize(const ZyanDeque* deque, ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_DEQUE_H */
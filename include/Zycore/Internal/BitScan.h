@@ -0,0 +1,115 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zyan-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Cross compiler bit scan intrinsics for internal use.
+ */
+
+#ifndef ZYCORE_BIT_SCAN_H
+#define ZYCORE_BIT_SCAN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <Zycore/Defines.h>
+#include <Zycore/Types.h>
+
+#if defined(ZYAN_MSVC) && !defined(ZYAN_CLANG)
+#   include <intrin.h>
+#endif
+
+/* ============================================================================================== */
+/* Functions                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * Returns the index of the least significant set bit.
+ *
+ * @param   value   The value. Must not be `0`.
+ *
+ * @return  The index of the least significant set bit.
+ */
+ZYAN_INLINE ZyanU32 ZyanBitScanForward32(ZyanU32 value)
+{
+    ZYAN_ASSERT(value);
+
+#if ZYAN_HAS_BUILTIN(__builtin_ctz) || defined(ZYAN_GCC)
+    return (ZyanU32)__builtin_ctz(value);
+#elif defined(ZYAN_MSVC)
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return (ZyanU32)index;
+#else
+    ZyanU32 index = 0;
+    while (!(value & 1))
+    {
+        value >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+/**
+ * Returns the index of the most significant set bit.
+ *
+ * @param   value   The value. Must not be `0`.
+ *
+ * @return  The index of the most significant set bit.
+ */
+ZYAN_INLINE ZyanU32 ZyanBitScanReverse(ZyanUSize value)
+{
+    ZYAN_ASSERT(value);
+
+#if ZYAN_HAS_BUILTIN(__builtin_clzll) || defined(ZYAN_GCC)
+    return (ZyanU32)(63 - __builtin_clzll((unsigned long long)value));
+#elif defined(ZYAN_MSVC) && (defined(ZYAN_X64) || defined(ZYAN_AARCH64))
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return (ZyanU32)index;
+#elif defined(ZYAN_MSVC)
+    unsigned long index;
+    _BitScanReverse(&index, (unsigned long)value);
+    return (ZyanU32)index;
+#else
+    ZyanU32 index = 0;
+    while (value >>= 1)
+    {
+        ++index;
+    }
+    return index;
+#endif
+}
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_BIT_SCAN_H */
@@ -34,6 +34,7 @@
 
 #include <Zycore/Allocator.h>
 #include <Zycore/Object.h>
+#include <Zycore/PoolAllocator.h>
 #include <Zycore/Status.h>
 #include <Zycore/Types.h>
 
@@ -152,6 +153,19 @@ typedef struct ZyanList_
 /* Helper macros                                                                                  */
 /* ---------------------------------------------------------------------------------------------- */
 
+/**
+ * Returns the number of bytes required to store a single list node (including the element).
+ *
+ * @param   element_size    The size of a single element in bytes.
+ *
+ * @return  The number of bytes required to store a single list node.
+ *
+ * Use this value as block size when initializing a `ZyanPoolAllocator` for
+ * `ZyanListInitPooled`.
+ */
+#define ZYAN_LIST_NODE_SIZE(element_size) \
+    (sizeof(ZyanListNode) + (element_size))
+
 /**
  * Returns the data value of the given `node`.
  *
@@ -217,6 +231,29 @@ ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanListInit(ZyanList* list, ZyanUSi
 ZYCORE_EXPORT ZyanStatus ZyanListInitEx(ZyanList* list, ZyanUSize element_size,
     ZyanMemberProcedure destructor, ZyanAllocator* allocator);
 
+/**
+ * Initializes the given `ZyanList` instance and configures it to allocate its nodes from the
+ * given `pool`.
+ *
+ * @param   list            A pointer to the `ZyanList` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   destructor      A destructor callback that is invoked every time an item is deleted, or
+ *                          `ZYAN_NULL` if not needed.
+ * @param   pool            A pointer to an initialized `ZyanPoolAllocator` instance with a block
+ *                          size of at least `ZYAN_LIST_NODE_SIZE(element_size)` bytes.
+ *
+ * @return  A zyan status code.
+ *
+ * Nodes released by push/pop operations are recycled by the pool, which avoids a call to the
+ * backing allocator for most operations. A single pool can be shared by multiple lists with
+ * the same (or a smaller) element size.
+ *
+ * Finalization with `ZyanListDestroy` is required for all instances created by this function.
+ * The pool must outlive the list.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanListInitPooled(ZyanList* list, ZyanUSize element_size,
+    ZyanMemberProcedure destructor, ZyanPoolAllocator* pool);
+
 /**
  * Initializes the given `ZyanList` instance and configures it to use a custom user
  * defined buffer with a fixed size.
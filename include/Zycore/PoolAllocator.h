@@ -0,0 +1,223 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a fixed-size block (pool) allocator.
+ */
+
+#ifndef ZYCORE_POOL_ALLOCATOR_H
+#define ZYCORE_POOL_ALLOCATOR_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The default number of blocks per slab.
+ */
+#define ZYAN_POOL_DEFAULT_BLOCKS_PER_SLAB   256
+
+/**
+ * The alignment (in bytes) of all memory blocks returned by the pool allocator.
+ */
+#define ZYAN_POOL_ALIGNMENT                 (2 * sizeof(void*))
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanPoolSlab` struct.
+ *
+ * The slab header is directly followed by the memory of the blocks.
+ */
+typedef struct ZyanPoolSlab_
+{
+    /**
+     * A pointer to the next slab.
+     */
+    struct ZyanPoolSlab_* next;
+} ZyanPoolSlab;
+
+/**
+ * Defines the `ZyanPoolAllocator` struct.
+ *
+ * The pool allocator hands out memory blocks of a single fixed size. Blocks are carved out of
+ * larger slabs obtained from a backing allocator, and released blocks are kept in an intrusive
+ * free list for reuse. Slabs are only returned to the backing allocator by `ZyanPoolDestroy`.
+ *
+ * Pass a pointer to the `allocator` field to any of the `*InitEx` functions to use the pool for
+ * a container instance. Requests larger than the block size fail with
+ * `ZYAN_STATUS_INVALID_ARGUMENT`.
+ *
+ * All other fields in this struct should be considered as "private". Any changes may lead to
+ * unexpected behavior.
+ */
+typedef struct ZyanPoolAllocator_
+{
+    /**
+     * The base allocator.
+     */
+    ZyanAllocator allocator;
+    /**
+     * The backing allocator used to obtain new slabs or `ZYAN_NULL`, if the pool uses a custom
+     * user defined buffer.
+     */
+    ZyanAllocator* backing;
+    /**
+     * The size of a single block (in bytes).
+     */
+    ZyanUSize block_size;
+    /**
+     * The number of blocks per slab.
+     */
+    ZyanUSize blocks_per_slab;
+    /**
+     * The head of the slab list.
+     */
+    ZyanPoolSlab* slabs;
+    /**
+     * The head of the intrusive free list.
+     */
+    void* free_list;
+    /**
+     * A pointer to the first block of the most recent slab that was never handed out.
+     */
+    ZyanU8* unused;
+    /**
+     * The number of never used blocks remaining in the most recent slab.
+     */
+    ZyanUSize unused_count;
+} ZyanPoolAllocator;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanPoolAllocator` instance.
+ *
+ * @param   pool            A pointer to the `ZyanPoolAllocator` instance.
+ * @param   block_size      The size of a single block (in bytes).
+ * @param   blocks_per_slab The number of blocks per slab or `0` to use the default value.
+ *
+ * @return  A zyan status code.
+ *
+ * The slabs are obtained from the default allocator.
+ *
+ * Finalization with `ZyanPoolDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanPoolInit(ZyanPoolAllocator* pool,
+    ZyanUSize block_size, ZyanUSize blocks_per_slab);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanPoolAllocator` instance and sets a custom backing `allocator`.
+ *
+ * @param   pool            A pointer to the `ZyanPoolAllocator` instance.
+ * @param   block_size      The size of a single block (in bytes).
+ * @param   blocks_per_slab The number of blocks per slab or `0` to use the default value.
+ * @param   backing         A pointer to the `ZyanAllocator` instance used to obtain new slabs.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanPoolDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPoolInitEx(ZyanPoolAllocator* pool, ZyanUSize block_size,
+    ZyanUSize blocks_per_slab, ZyanAllocator* backing);
+
+/**
+ * Initializes the given `ZyanPoolAllocator` instance and configures it to use a custom user
+ * defined buffer with a fixed size.
+ *
+ * @param   pool        A pointer to the `ZyanPoolAllocator` instance.
+ * @param   block_size  The size of a single block (in bytes).
+ * @param   buffer      A pointer to the buffer that is used as the only slab.
+ * @param   capacity    The size of the buffer (in bytes).
+ *
+ * @return  A zyan status code.
+ *
+ * Allocations fail with `ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE` once the buffer is exhausted.
+ *
+ * Finalization is not required for instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPoolInitCustomBuffer(ZyanPoolAllocator* pool, ZyanUSize block_size,
+    void* buffer, ZyanUSize capacity);
+
+/**
+ * Destroys the given `ZyanPoolAllocator` instance and releases all slabs.
+ *
+ * @param   pool    A pointer to the `ZyanPoolAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * All memory blocks previously obtained from the pool become invalid.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPoolDestroy(ZyanPoolAllocator* pool);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the size of a single block of the pool.
+ *
+ * @param   pool        A pointer to the `ZyanPoolAllocator` instance.
+ * @param   block_size  Receives the size of a single block (in bytes).
+ *
+ * @return  A zyan status code.
+ *
+ * The returned value might be larger than the size passed to the constructor, as blocks are
+ * padded to the pool alignment.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPoolGetBlockSize(const ZyanPoolAllocator* pool,
+    ZyanUSize* block_size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_POOL_ALLOCATOR_H */
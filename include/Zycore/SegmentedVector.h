@@ -0,0 +1,425 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements the segmented vector container class.
+ */
+
+#ifndef ZYCORE_SEGMENTED_VECTOR_H
+#define ZYCORE_SEGMENTED_VECTOR_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Object.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The maximum number of blocks of a segmented vector.
+ */
+#define ZYAN_SEGMENTED_VECTOR_MAX_BLOCKS                32
+
+/**
+ * The default capacity (number of elements) of the first block.
+ */
+#define ZYAN_SEGMENTED_VECTOR_DEFAULT_BLOCK_CAPACITY    16
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanSegmentedVector` struct.
+ *
+ * A segmented vector stores its elements in a sequence of separately allocated blocks. Every
+ * block is twice as large as the previous one, so that the position of an element can be
+ * calculated in constant time. Growing the vector adds a new block instead of relocating the
+ * existing elements, which means that pointers to elements stay valid until the element is
+ * removed.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanSegmentedVector_
+{
+    /**
+     * The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The current number of elements in the vector.
+     */
+    ZyanUSize size;
+    /**
+     * The total capacity (number of elements) of all allocated blocks.
+     */
+    ZyanUSize capacity;
+    /**
+     * The size of a single element in bytes.
+     */
+    ZyanUSize element_size;
+    /**
+     * The binary logarithm of the capacity of the first block.
+     */
+    ZyanU8 block_shift;
+    /**
+     * The number of allocated blocks.
+     */
+    ZyanU8 block_count;
+    /**
+     * The element destructor callback.
+     */
+    ZyanMemberProcedure destructor;
+    /**
+     * The block pointers.
+     */
+    void* blocks[ZYAN_SEGMENTED_VECTOR_MAX_BLOCKS];
+} ZyanSegmentedVector;
+
+/* ============================================================================================== */
+/* Macros                                                                                         */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* General                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Defines an uninitialized `ZyanSegmentedVector` instance.
+ */
+#define ZYAN_SEGMENTED_VECTOR_INITIALIZER \
+    { \
+        /* allocator        */ ZYAN_NULL, \
+        /* size             */ 0, \
+        /* capacity         */ 0, \
+        /* element_size     */ 0, \
+        /* block_shift      */ 0, \
+        /* block_count      */ 0, \
+        /* destructor       */ ZYAN_NULL, \
+        /* blocks           */ { ZYAN_NULL } \
+    }
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper macros                                                                                  */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the value of the element at the given `index`.
+ *
+ * @param   type    The desired value type.
+ * @param   vector  A pointer to the `ZyanSegmentedVector` instance.
+ * @param   index   The element index.
+ *
+ * @result  The value of the desired element in the vector.
+ *
+ * Note that this function is unsafe and might dereference a null-pointer.
+ */
+#ifdef __cplusplus
+#define ZYAN_SEGMENTED_VECTOR_GET(type, vector, index) \
+    (*reinterpret_cast<const type*>(ZyanSegmentedVectorGet(vector, index)))
+#else
+#define ZYAN_SEGMENTED_VECTOR_GET(type, vector, index) \
+    (*(const type*)ZyanSegmentedVectorGet(vector, index))
+#endif
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanSegmentedVector` instance.
+ *
+ * @param   vector          A pointer to the `ZyanSegmentedVector` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   block_capacity  The capacity (number of elements) of the first block or `0` to use
+ *                          `ZYAN_SEGMENTED_VECTOR_DEFAULT_BLOCK_CAPACITY`. This value is rounded
+ *                          up to the next power of two.
+ * @param   destructor      A destructor callback that is invoked every time an item is deleted, or
+ *                          `ZYAN_NULL` if not needed.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the blocks is dynamically allocated by the default allocator. No memory is
+ * allocated before the first element is added.
+ *
+ * Finalization with `ZyanSegmentedVectorDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanSegmentedVectorInit(ZyanSegmentedVector* vector,
+    ZyanUSize element_size, ZyanUSize block_capacity, ZyanMemberProcedure destructor);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanSegmentedVector` instance and sets a custom `allocator`.
+ *
+ * @param   vector          A pointer to the `ZyanSegmentedVector` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   block_capacity  The capacity (number of elements) of the first block or `0` to use
+ *                          `ZYAN_SEGMENTED_VECTOR_DEFAULT_BLOCK_CAPACITY`. This value is rounded
+ *                          up to the next power of two.
+ * @param   destructor      A destructor callback that is invoked every time an item is deleted, or
+ *                          `ZYAN_NULL` if not needed.
+ * @param   allocator       A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanSegmentedVectorDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSegmentedVectorInitEx(ZyanSegmentedVector* vector,
+    ZyanUSize element_size, ZyanUSize block_capacity, ZyanMemberProcedure destructor,
+    ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanSegmentedVector` instance.
+ *
+ * @param   vector  A pointer to the `ZyanSegmentedVector` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSegmentedVectorDestroy(ZyanSegmentedVector* vector);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Element access                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns a constant pointer to the element at the given `index`.
+ *
+ * @param   vector  A pointer to the `ZyanSegmentedVector` instance.
+ * @param   index   The element index.
+ *
+ * @return  A constant pointer to the desired element in the vector or `ZYAN_NULL`, if an error
+ *          occurred.
+ *
+ * The returned pointer stays valid until the element is removed from the vector.
+ *
+ * Take a look at `ZyanSegmentedVectorGetPointer` instead, if you need a function that returns a
+ * zyan status code.
+ */
+ZYCORE_EXPORT const void* ZyanSegmentedVectorGet(const ZyanSegmentedVector* vector,
+    ZyanUSize index);
+
+/**
+ * Returns a mutable pointer to the element at the given `index`.
+ *
+ * @param   vector  A pointer to the `ZyanSegmentedVector` instance.
+ * @param   index   The element index.
+ *
+ * @return  A mutable pointer to the desired element in the vector or `ZYAN_NULL`, if an error
+ *          occurred.
+ *
+ * The returned pointer stays valid until the element is removed from the vector.
+ *
+ * Take a look at `ZyanSegmentedVectorGetPointerMutable` instead, if you need a function that
+ * returns a zyan status code.
+ */
+ZYCORE_EXPORT void* ZyanSegmentedVectorGetMutable(const ZyanSegmentedVector* vector,
+    ZyanUSize index);
+
+/**
+ * Returns a constant pointer to the element at the given `index`.
+ *
+ * @param   vector  A pointer to the `ZyanSegmentedVector` instance.
+ * @param   index   The element index.
+ * @param   value   Receives a constant pointer to the desired element in the vector.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSegmentedVectorGetPointer(const ZyanSegmentedVector* vector,
+    ZyanUSize index, const void** value);
+
+/**
+ * Returns a mutable pointer to the element at the given `index`.
+ *
+ * @param   vector  A pointer to the `ZyanSegmentedVector` instance.
+ * @param   index   The element index.
+ * @param   value   Receives a mutable pointer to the desired element in the vector.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSegmentedVectorGetPointerMutable(const ZyanSegmentedVector* vector,
+    ZyanUSize index, void** value);
+
+/**
+ * Assigns a new value to the element at the given `index`.
+ *
+ * @param   vector  A pointer to the `ZyanSegmentedVector` instance.
+ * @param   index   The value index.
+ * @param   value   The value to assign.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSegmentedVectorSet(ZyanSegmentedVector* vector, ZyanUSize index,
+    const void* value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Adds a new `element` to the end of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanSegmentedVector` instance.
+ * @param   element A pointer to the element to add.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSegmentedVectorPushBack(ZyanSegmentedVector* vector,
+    const void* element);
+
+/**
+ * Constructs an `element` in-place at the end of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanSegmentedVector` instance.
+ * @param   element Receives a pointer to the new element.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSegmentedVectorEmplace(ZyanSegmentedVector* vector, void** element);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Removes the last element of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanSegmentedVector` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSegmentedVectorPopBack(ZyanSegmentedVector* vector);
+
+/**
+ * Erases all elements of the given vector.
+ *
+ * @param   vector  A pointer to the `ZyanSegmentedVector` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * The allocated blocks are kept for reuse. Call `ZyanSegmentedVectorShrinkToFit` to release them.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSegmentedVectorClear(ZyanSegmentedVector* vector);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Resizes the given `ZyanSegmentedVector` instance.
+ *
+ * @param   vector  A pointer to the `ZyanSegmentedVector` instance.
+ * @param   size    The new size of the vector.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSegmentedVectorResize(ZyanSegmentedVector* vector, ZyanUSize size);
+
+/**
+ * Resizes the given `ZyanSegmentedVector` instance.
+ *
+ * @param   vector      A pointer to the `ZyanSegmentedVector` instance.
+ * @param   size        The new size of the vector.
+ * @param   initializer A pointer to a value to be used as initializer for new items.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSegmentedVectorResizeEx(ZyanSegmentedVector* vector, ZyanUSize size,
+    const void* initializer);
+
+/**
+ * Changes the capacity of the given `ZyanSegmentedVector` instance.
+ *
+ * @param   vector      A pointer to the `ZyanSegmentedVector` instance.
+ * @param   capacity    The new minimum capacity of the vector.
+ *
+ * @return  A zyan status code.
+ *
+ * The capacity grows by whole blocks and never decreases.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSegmentedVectorReserve(ZyanSegmentedVector* vector,
+    ZyanUSize capacity);
+
+/**
+ * Releases all blocks of the given vector that do not contain any elements.
+ *
+ * @param   vector  A pointer to the `ZyanSegmentedVector` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSegmentedVectorShrinkToFit(ZyanSegmentedVector* vector);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the current capacity of the vector.
+ *
+ * @param   vector      A pointer to the `ZyanSegmentedVector` instance.
+ * @param   capacity    Receives the capacity of the vector.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSegmentedVectorGetCapacity(const ZyanSegmentedVector* vector,
+    ZyanUSize* capacity);
+
+/**
+ * Returns the current size of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanSegmentedVector` instance.
+ * @param   size    Receives the size of the vector.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSegmentedVectorGetSize(const ZyanSegmentedVector* vector,
+    ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_SEGMENTED_VECTOR_H */
@@ -0,0 +1,406 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements the structure-of-arrays vector container class.
+ */
+
+#ifndef ZYCORE_SOA_VECTOR_H
+#define ZYCORE_SOA_VECTOR_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The maximum number of fields of a structure-of-arrays vector.
+ */
+#define ZYAN_SOA_VECTOR_MAX_FIELDS              16
+
+/**
+ * The alignment (in bytes) of the columns relative to the start of the buffer.
+ */
+#define ZYAN_SOA_VECTOR_COLUMN_ALIGNMENT        64
+
+/**
+ * The default growth factor for all structure-of-arrays vector instances.
+ */
+#define ZYAN_SOA_VECTOR_DEFAULT_GROWTH_FACTOR   2
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanSoAVector` struct.
+ *
+ * A structure-of-arrays vector stores records that consist of multiple fields. Instead of storing
+ * the records contiguously, every field is stored in its own column, which makes scans over a
+ * single field dense. All columns share a single buffer and capacity.
+ *
+ * The fields are plain data and there is no destructor support.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanSoAVector_
+{
+    /**
+     * The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The growth factor.
+     */
+    ZyanU8 growth_factor;
+    /**
+     * The current number of records in the vector.
+     */
+    ZyanUSize size;
+    /**
+     * The maximum capacity (number of records).
+     */
+    ZyanUSize capacity;
+    /**
+     * The number of fields of a single record.
+     */
+    ZyanUSize field_count;
+    /**
+     * The size of each field in bytes.
+     */
+    ZyanUSize field_sizes[ZYAN_SOA_VECTOR_MAX_FIELDS];
+    /**
+     * The column pointers.
+     */
+    void* columns[ZYAN_SOA_VECTOR_MAX_FIELDS];
+    /**
+     * The buffer that holds all columns.
+     */
+    void* data;
+    /**
+     * The size of the buffer in bytes.
+     */
+    ZyanUSize data_size;
+} ZyanSoAVector;
+
+/* ============================================================================================== */
+/* Macros                                                                                         */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper macros                                                                                  */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the value of the given field of the record at the given `index`.
+ *
+ * @param   type    The desired value type.
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   index   The record index.
+ * @param   field   The field index.
+ *
+ * @result  The value of the desired field in the vector.
+ *
+ * Note that this function is unsafe and might dereference a null-pointer.
+ */
+#ifdef __cplusplus
+#define ZYAN_SOA_VECTOR_GET(type, vector, index, field) \
+    (*reinterpret_cast<const type*>(ZyanSoAVectorGet(vector, index, field)))
+#else
+#define ZYAN_SOA_VECTOR_GET(type, vector, index, field) \
+    (*(const type*)ZyanSoAVectorGet(vector, index, field))
+#endif
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanSoAVector` instance.
+ *
+ * @param   vector      A pointer to the `ZyanSoAVector` instance.
+ * @param   field_sizes A pointer to an array that contains the size of each field in bytes.
+ * @param   field_count The number of fields. Must not exceed `ZYAN_SOA_VECTOR_MAX_FIELDS`.
+ * @param   capacity    The initial capacity (number of records).
+ *
+ * @return  A zyan status code.
+ *
+ * The buffer is allocated by the aligned default allocator (see `ZyanAllocatorDefaultAligned`),
+ * so that every column starts at a `ZYAN_SOA_VECTOR_COLUMN_ALIGNMENT` byte boundary.
+ *
+ * Finalization with `ZyanSoAVectorDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanSoAVectorInit(ZyanSoAVector* vector,
+    const ZyanUSize* field_sizes, ZyanUSize field_count, ZyanUSize capacity);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanSoAVector` instance and sets a custom `allocator` and growth factor.
+ *
+ * @param   vector          A pointer to the `ZyanSoAVector` instance.
+ * @param   field_sizes     A pointer to an array that contains the size of each field in bytes.
+ * @param   field_count     The number of fields. Must not exceed `ZYAN_SOA_VECTOR_MAX_FIELDS`.
+ * @param   capacity        The initial capacity (number of records).
+ * @param   allocator       A pointer to a `ZyanAllocator` instance.
+ * @param   growth_factor   The growth factor.
+ *
+ * @return  A zyan status code.
+ *
+ * The columns are aligned to `ZYAN_SOA_VECTOR_COLUMN_ALIGNMENT` bytes relative to the start of
+ * the buffer. They are only aligned in memory, if the `allocator` returns buffers with at least
+ * this alignment.
+ *
+ * Finalization with `ZyanSoAVectorDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorInitEx(ZyanSoAVector* vector, const ZyanUSize* field_sizes,
+    ZyanUSize field_count, ZyanUSize capacity, ZyanAllocator* allocator, ZyanU8 growth_factor);
+
+/**
+ * Destroys the given `ZyanSoAVector` instance.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorDestroy(ZyanSoAVector* vector);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Element access                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns a constant pointer to the column of the given `field`.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   field   The field index.
+ *
+ * @return  A constant pointer to the first entry of the column or `ZYAN_NULL`, if an error
+ *          occurred.
+ *
+ * The column holds `size` densely packed entries. Note that the returned pointer might get
+ * invalid when the vector is resized.
+ */
+ZYCORE_EXPORT const void* ZyanSoAVectorGetColumn(const ZyanSoAVector* vector, ZyanUSize field);
+
+/**
+ * Returns a mutable pointer to the column of the given `field`.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   field   The field index.
+ *
+ * @return  A mutable pointer to the first entry of the column or `ZYAN_NULL`, if an error
+ *          occurred.
+ *
+ * The column holds `size` densely packed entries. Note that the returned pointer might get
+ * invalid when the vector is resized.
+ */
+ZYCORE_EXPORT void* ZyanSoAVectorGetColumnMutable(const ZyanSoAVector* vector, ZyanUSize field);
+
+/**
+ * Returns a constant pointer to the given `field` of the record at the given `index`.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   index   The record index.
+ * @param   field   The field index.
+ *
+ * @return  A constant pointer to the desired field or `ZYAN_NULL`, if an error occurred.
+ */
+ZYCORE_EXPORT const void* ZyanSoAVectorGet(const ZyanSoAVector* vector, ZyanUSize index,
+    ZyanUSize field);
+
+/**
+ * Returns a mutable pointer to the given `field` of the record at the given `index`.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   index   The record index.
+ * @param   field   The field index.
+ *
+ * @return  A mutable pointer to the desired field or `ZYAN_NULL`, if an error occurred.
+ */
+ZYCORE_EXPORT void* ZyanSoAVectorGetMutable(const ZyanSoAVector* vector, ZyanUSize index,
+    ZyanUSize field);
+
+/**
+ * Copies all fields of the record at the given `index`.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   index   The record index.
+ * @param   fields  A pointer to an array of `field_count` destination pointers. Fields with a
+ *                  `ZYAN_NULL` destination are skipped.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorGetRecord(const ZyanSoAVector* vector, ZyanUSize index,
+    void* const* fields);
+
+/**
+ * Assigns new values to the fields of the record at the given `index`.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   index   The record index.
+ * @param   fields  A pointer to an array of `field_count` source pointers. Fields with a
+ *                  `ZYAN_NULL` source are left unchanged.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorSet(ZyanSoAVector* vector, ZyanUSize index,
+    const void* const* fields);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Adds a new record to the end of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   fields  A pointer to an array of `field_count` source pointers. Fields with a
+ *                  `ZYAN_NULL` source are zero-initialized.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorPushBack(ZyanSoAVector* vector, const void* const* fields);
+
+/**
+ * Adds a new uninitialized record to the end of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   fields  A pointer to an array that receives `field_count` pointers to the fields of
+ *                  the new record.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorEmplace(ZyanSoAVector* vector, void** fields);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Removes the last record of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorPopBack(ZyanSoAVector* vector);
+
+/**
+ * Erases all records of the given vector.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorClear(ZyanSoAVector* vector);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Resizes the given `ZyanSoAVector` instance.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   size    The new size of the vector.
+ *
+ * @return  A zyan status code.
+ *
+ * New records are zero-initialized.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorResize(ZyanSoAVector* vector, ZyanUSize size);
+
+/**
+ * Changes the capacity of the given `ZyanSoAVector` instance.
+ *
+ * @param   vector      A pointer to the `ZyanSoAVector` instance.
+ * @param   capacity    The new minimum capacity of the vector.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorReserve(ZyanSoAVector* vector, ZyanUSize capacity);
+
+/**
+ * Shrinks the capacity of the given vector to match its size.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorShrinkToFit(ZyanSoAVector* vector);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the current capacity of the vector.
+ *
+ * @param   vector      A pointer to the `ZyanSoAVector` instance.
+ * @param   capacity    Receives the capacity of the vector.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorGetCapacity(const ZyanSoAVector* vector,
+    ZyanUSize* capacity);
+
+/**
+ * Returns the current size of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   size    Receives the size of the vector.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanSoAVectorGetSize(const ZyanSoAVector* vector, ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_SOA_VECTOR_H */
@@ -0,0 +1,234 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements an instrumented allocator wrapper that records allocation statistics.
+ */
+
+#ifndef ZYCORE_STATS_ALLOCATOR_H
+#define ZYCORE_STATS_ALLOCATOR_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Atomic.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The number of buckets in the size-class histogram.
+ *
+ * Bucket `0` counts requests of a single byte and bucket `i` counts requests in the range
+ * `(2^(i-1), 2^i]`. The last bucket additionally counts all larger requests.
+ */
+#define ZYAN_STATS_HISTOGRAM_SIZE   32
+
+/**
+ * The alignment (in bytes) of all memory blocks returned by the stats allocator.
+ */
+#define ZYAN_STATS_ALIGNMENT        (2 * sizeof(void*))
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanStatsAllocatorSnapshot` struct.
+ */
+typedef struct ZyanStatsAllocatorSnapshot_
+{
+    /**
+     * The number of successful `allocate()` calls.
+     */
+    ZyanU64 allocations;
+    /**
+     * The number of successful `reallocate()` calls.
+     */
+    ZyanU64 reallocations;
+    /**
+     * The number of `expand()` calls that grew a memory block in place.
+     */
+    ZyanU64 expansions;
+    /**
+     * The number of `deallocate()` calls.
+     */
+    ZyanU64 deallocations;
+    /**
+     * The number of bytes currently allocated.
+     */
+    ZyanU64 live_bytes;
+    /**
+     * The highest number of bytes allocated at the same time.
+     */
+    ZyanU64 peak_bytes;
+    /**
+     * The size-class histogram of all successful `allocate()`, `reallocate()` and `expand()`
+     * requests.
+     */
+    ZyanU64 histogram[ZYAN_STATS_HISTOGRAM_SIZE];
+} ZyanStatsAllocatorSnapshot;
+
+/**
+ * Defines the `ZyanStatsAllocator` struct.
+ *
+ * The stats allocator forwards all requests to a backing allocator and records allocation,
+ * reallocation and deallocation counts, the number of live and peak bytes, and a histogram of
+ * the requested sizes. All counters are updated atomically, so a single instance may be shared
+ * between threads, if the backing allocator is thread-safe.
+ *
+ * Pass a pointer to the `allocator` field to any of the `*InitEx` functions to instrument a
+ * container instance.
+ *
+ * Each block is prefixed with a small header that records its size. The alignment of the returned
+ * memory blocks is therefore limited to `ZYAN_STATS_ALIGNMENT`.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to
+ * unexpected behavior. Use `ZyanStatsAllocatorGetSnapshot` to read the counters.
+ */
+typedef struct ZyanStatsAllocator_
+{
+    /**
+     * The base allocator.
+     */
+    ZyanAllocator allocator;
+    /**
+     * The backing allocator.
+     */
+    ZyanAllocator* backing;
+    /**
+     * The number of successful `allocate()` calls.
+     */
+    ZyanAtomic64 allocations;
+    /**
+     * The number of successful `reallocate()` calls.
+     */
+    ZyanAtomic64 reallocations;
+    /**
+     * The number of `expand()` calls that grew a memory block in place.
+     */
+    ZyanAtomic64 expansions;
+    /**
+     * The number of `deallocate()` calls.
+     */
+    ZyanAtomic64 deallocations;
+    /**
+     * The number of bytes currently allocated.
+     */
+    ZyanAtomic64 live_bytes;
+    /**
+     * The highest number of bytes allocated at the same time.
+     */
+    ZyanAtomic64 peak_bytes;
+    /**
+     * The size-class histogram.
+     */
+    ZyanAtomic64 histogram[ZYAN_STATS_HISTOGRAM_SIZE];
+} ZyanStatsAllocator;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanStatsAllocator` instance.
+ *
+ * @param   stats   A pointer to the `ZyanStatsAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * All requests are forwarded to the default allocator.
+ *
+ * Finalization is not required for instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanStatsAllocatorInit(ZyanStatsAllocator* stats);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanStatsAllocator` instance and sets a custom backing `allocator`.
+ *
+ * @param   stats   A pointer to the `ZyanStatsAllocator` instance.
+ * @param   backing A pointer to the `ZyanAllocator` instance all requests are forwarded to.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization is not required for instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStatsAllocatorInitEx(ZyanStatsAllocator* stats,
+    ZyanAllocator* backing);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Statistics                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns a snapshot of the current statistics.
+ *
+ * @param   stats       A pointer to the `ZyanStatsAllocator` instance.
+ * @param   snapshot    Receives the current statistics.
+ *
+ * @return  A zyan status code.
+ *
+ * Each counter is read atomically, but the snapshot as a whole is not consistent, if other
+ * threads use the allocator concurrently.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStatsAllocatorGetSnapshot(ZyanStatsAllocator* stats,
+    ZyanStatsAllocatorSnapshot* snapshot);
+
+/**
+ * Resets all counters of the given `ZyanStatsAllocator` instance.
+ *
+ * @param   stats   A pointer to the `ZyanStatsAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * The number of live bytes is retained, as the corresponding memory blocks are still allocated.
+ * The peak is reset to the number of live bytes.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStatsAllocatorReset(ZyanStatsAllocator* stats);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_STATS_ALLOCATOR_H */
@@ -61,6 +61,12 @@ extern "C" {
  */
 #define ZYAN_STRING_DEFAULT_SHRINK_THRESHOLD    4
 
+/**
+ * The size of the inline buffer of `ZyanSmallString` instances (number of characters), including
+ * the terminating '\0'.
+ */
+#define ZYAN_SMALL_STRING_CAPACITY              32
+
 /* ============================================================================================== */
 /* Enums and types                                                                                */
 /* ============================================================================================== */
@@ -106,6 +112,37 @@ typedef struct ZyanString_
     ZyanVector vector;
 } ZyanString;
 
+/**
+ * Defines the `ZyanSmallString` struct.
+ *
+ * The `ZyanSmallString` type is a `ZyanString` with small-string optimization. Contents of up to
+ * `ZYAN_SMALL_STRING_CAPACITY - 1` characters are stored in the inline buffer, and the string
+ * only spills to its allocator once it grows past that threshold.
+ *
+ * Pass a pointer to the `string` field to any of the `ZyanString*` functions (including
+ * `ZYAN_STRING_TO_VIEW`) to use the string.
+ *
+ * The struct contains pointers to itself and must not be copied or moved after initialization.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanSmallString_
+{
+    /**
+     * The string.
+     */
+    ZyanString string;
+    /**
+     * The allocator that hands out the inline buffer.
+     */
+    ZyanSmallBufferAllocator allocator;
+    /**
+     * The inline buffer.
+     */
+    char buffer[ZYAN_SMALL_STRING_CAPACITY];
+} ZyanSmallString;
+
 /* ---------------------------------------------------------------------------------------------- */
 /* View                                                                                           */
 /* ---------------------------------------------------------------------------------------------- */
@@ -186,7 +223,9 @@ typedef struct ZyanStringView_
                 /* capacity         */ sizeof(string), \
                 /* element_size     */ sizeof(char), \
                 /* destructor       */ ZYAN_NULL, \
-                /* data             */ (char*)(string) \
+                /* data             */ (char*)(string), \
+                /* growth_policy    */ ZYAN_NULL, \
+                /* shrink_pending   */ 0 \
             } \
         } \
     }
@@ -262,6 +301,44 @@ ZYCORE_EXPORT ZyanStatus ZyanStringInitEx(ZyanString* string, ZyanUSize capacity
 ZYCORE_EXPORT ZyanStatus ZyanStringInitCustomBuffer(ZyanString* string, char* buffer,
     ZyanUSize capacity);
 
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanSmallString` instance.
+ *
+ * @param   string  A pointer to the `ZyanSmallString` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * The string starts in the inline buffer and spills to the default allocator using the default
+ * growth factor and the default shrink threshold.
+ *
+ * Finalization with `ZyanStringDestroy` is required for all strings created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanStringInitSmall(ZyanSmallString* string);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanSmallString` instance and sets a custom `allocator` and memory
+ * allocation/deallocation parameters.
+ *
+ * @param   string              A pointer to the `ZyanSmallString` instance.
+ * @param   allocator           A pointer to the `ZyanAllocator` instance used once the string
+ *                              outgrows the inline buffer.
+ * @param   growth_factor       The growth factor.
+ * @param   shrink_threshold    The shrink threshold.
+ *
+ * @return  A zyan status code.
+ *
+ * A growth factor of `1` disables overallocation and a shrink threshold of `0` disables
+ * dynamic shrinking.
+ *
+ * Finalization with `ZyanStringDestroy` is required for all strings created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringInitSmallEx(ZyanSmallString* string, ZyanAllocator* allocator,
+    ZyanU8 growth_factor, ZyanU8 shrink_threshold);
+
 /**
  * Destroys the given `ZyanString` instance.
  *
@@ -965,6 +1042,23 @@ ZYCORE_EXPORT ZyanStatus ZyanStringReserve(ZyanString* string, ZyanUSize capacit
  */
 ZYCORE_EXPORT ZyanStatus ZyanStringShrinkToFit(ZyanString* string);
 
+/**
+ * Sets the growth policy of the given `ZyanString` instance.
+ *
+ * @param   string  A pointer to the `ZyanString` instance.
+ * @param   policy  A pointer to the `ZyanVectorGrowthPolicy` instance or `ZYAN_NULL` to restore
+ *                  the `growth_factor` and `shrink_threshold` based behavior.
+ *
+ * @return  A zyan status code.
+ *
+ * The string only stores a pointer to the policy, which has to outlive the string.
+ *
+ * This function will fail, if the `ZYAN_STRING_IS_IMMUTABLE` flag is set for the specified
+ * `ZyanString` instance.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringSetGrowthPolicy(ZyanString* string,
+    const ZyanVectorGrowthPolicy* policy);
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Information                                                                                    */
 /* ---------------------------------------------------------------------------------------------- */
@@ -1002,6 +1096,111 @@ ZYCORE_EXPORT ZyanStatus ZyanStringGetData(const ZyanString* string, const char*
 
 /* ---------------------------------------------------------------------------------------------- */
 
+/* ============================================================================================== */
+/* Inline fast paths                                                                              */
+/* ============================================================================================== */
+
+#ifdef ZYCORE_INLINE_FASTPATH
+
+/*
+ * With `ZYCORE_INLINE_FASTPATH` defined, calls to the trivial accessors are replaced by the inline
+ * implementations below. See `Vector.h` for details.
+ */
+
+ZYAN_INLINE ZyanStatus ZyanStringViewGetSizeInline(const ZyanStringView* view, ZyanUSize* size)
+{
+    if (!view || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = view->string.vector.size - 1;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZYAN_INLINE ZyanStatus ZyanStringViewGetDataInline(const ZyanStringView* view,
+    const char** buffer)
+{
+    if (!view || !buffer)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *buffer = (const char*)view->string.vector.data;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZYAN_INLINE ZyanStatus ZyanStringGetCharInline(const ZyanStringView* string, ZyanUSize index,
+    char* value)
+{
+    if (!string || !value)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index + 1 >= string->string.vector.size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    *value = ((const char*)string->string.vector.data)[index];
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZYAN_INLINE ZyanStatus ZyanStringGetCapacityInline(const ZyanString* string,
+    ZyanUSize* capacity)
+{
+    if (!string)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *capacity = string->vector.capacity - 1;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZYAN_INLINE ZyanStatus ZyanStringGetSizeInline(const ZyanString* string, ZyanUSize* size)
+{
+    if (!string)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = string->vector.size - 1;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZYAN_INLINE ZyanStatus ZyanStringGetDataInline(const ZyanString* string, const char** value)
+{
+    if (!string)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *value = (const char*)string->vector.data;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+#define ZyanStringViewGetSize(view, size) \
+    ZyanStringViewGetSizeInline(view, size)
+#define ZyanStringViewGetData(view, buffer) \
+    ZyanStringViewGetDataInline(view, buffer)
+#define ZyanStringGetChar(string, index, value) \
+    ZyanStringGetCharInline(string, index, value)
+#define ZyanStringGetCapacity(string, capacity) \
+    ZyanStringGetCapacityInline(string, capacity)
+#define ZyanStringGetSize(string, size) \
+    ZyanStringGetSizeInline(string, size)
+#define ZyanStringGetData(string, value) \
+    ZyanStringGetDataInline(string, value)
+
+#endif // ZYCORE_INLINE_FASTPATH
+
 /* ============================================================================================== */
 
 #ifdef __cplusplus
@@ -0,0 +1,205 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a thread-caching allocator.
+ */
+
+#ifndef ZYCORE_THREAD_CACHE_ALLOCATOR_H
+#define ZYCORE_THREAD_CACHE_ALLOCATOR_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+#include <Zycore/API/Thread.h>
+
+#ifndef ZYAN_NO_LIBC
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The number of size-classes cached per thread.
+ *
+ * The size-classes are the powers of two from `ZYAN_THREAD_CACHE_MIN_BLOCK_SIZE` up to and
+ * including `ZYAN_THREAD_CACHE_MAX_BLOCK_SIZE`.
+ */
+#define ZYAN_THREAD_CACHE_SIZE_CLASS_COUNT  8
+
+/**
+ * The size (in bytes) of the smallest size-class.
+ */
+#define ZYAN_THREAD_CACHE_MIN_BLOCK_SIZE    16
+
+/**
+ * The size (in bytes) of the largest size-class. Larger requests bypass the thread cache and
+ * are forwarded to the backing allocator.
+ */
+#define ZYAN_THREAD_CACHE_MAX_BLOCK_SIZE \
+    (ZYAN_THREAD_CACHE_MIN_BLOCK_SIZE << (ZYAN_THREAD_CACHE_SIZE_CLASS_COUNT - 1))
+
+/**
+ * The default maximum number of blocks cached per size-class and thread.
+ */
+#define ZYAN_THREAD_CACHE_DEFAULT_MAGAZINE_SIZE 64
+
+/**
+ * The alignment (in bytes) of all memory blocks returned by the thread-caching allocator.
+ */
+#define ZYAN_THREAD_CACHE_ALIGNMENT         (2 * sizeof(void*))
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanThreadCacheAllocator` struct.
+ *
+ * The thread-caching allocator keeps a private cache for every thread that uses it. Each cache
+ * holds one magazine (a bounded free list) per size-class, so that most allocations and
+ * deallocations are served without any synchronization. Memory blocks released by a thread
+ * other than the one that allocated them are handed back to the owning thread through a
+ * lock-free remote-free list. Requests larger than `ZYAN_THREAD_CACHE_MAX_BLOCK_SIZE` and
+ * magazine misses are forwarded to the backing allocator, which must be thread-safe.
+ *
+ * Pass a pointer to the `allocator` field to any of the `*InitEx` functions to use the
+ * thread-caching allocator for a container instance. The same instance may be shared by
+ * containers living on different threads.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to
+ * unexpected behavior.
+ */
+typedef struct ZyanThreadCacheAllocator_
+{
+    /**
+     * The base allocator.
+     */
+    ZyanAllocator allocator;
+    /**
+     * The thread-safe backing allocator.
+     */
+    ZyanAllocator* backing;
+    /**
+     * The maximum number of blocks cached per size-class and thread.
+     */
+    ZyanUSize magazine_size;
+    /**
+     * The Thread Local Storage (TLS) slot holding the per-thread cache.
+     */
+    ZyanThreadTlsIndex tls_index;
+} ZyanThreadCacheAllocator;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Initializes the given `ZyanThreadCacheAllocator` instance.
+ *
+ * @param   allocator       A pointer to the `ZyanThreadCacheAllocator` instance.
+ * @param   magazine_size   The maximum number of blocks cached per size-class and thread or `0`
+ *                          to use the default value.
+ *
+ * @return  A zyan status code.
+ *
+ * Magazine misses are served by the default allocator.
+ *
+ * Finalization with `ZyanThreadCacheDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanThreadCacheInit(
+    ZyanThreadCacheAllocator* allocator, ZyanUSize magazine_size);
+
+/**
+ * Initializes the given `ZyanThreadCacheAllocator` instance and sets a custom backing
+ * `allocator`.
+ *
+ * @param   allocator       A pointer to the `ZyanThreadCacheAllocator` instance.
+ * @param   magazine_size   The maximum number of blocks cached per size-class and thread or `0`
+ *                          to use the default value.
+ * @param   backing         A pointer to the thread-safe `ZyanAllocator` instance used to serve
+ *                          magazine misses and large requests.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanThreadCacheDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanThreadCacheInitEx(
+    ZyanThreadCacheAllocator* allocator, ZyanUSize magazine_size, ZyanAllocator* backing);
+
+/**
+ * Destroys the given `ZyanThreadCacheAllocator` instance.
+ *
+ * @param   allocator   A pointer to the `ZyanThreadCacheAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * The cache of the calling thread is released immediately. The caches of all other threads are
+ * released when these threads exit, so every other thread that used the allocator must have
+ * exited before this function is called.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanThreadCacheDestroy(
+    ZyanThreadCacheAllocator* allocator);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Cache management                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns all memory blocks cached by the calling thread to the backing allocator.
+ *
+ * @param   allocator   A pointer to the `ZyanThreadCacheAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Blocks released by other threads that are pending on the remote-free list of the calling
+ * thread are returned as well.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanThreadCacheFlush(
+    ZyanThreadCacheAllocator* allocator);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYAN_NO_LIBC */
+
+#endif /* ZYCORE_THREAD_CACHE_ALLOCATOR_H */
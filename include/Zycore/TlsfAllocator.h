@@ -0,0 +1,187 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a two-level segregated fit (TLSF) allocator for caller-provided memory regions.
+ */
+
+#ifndef ZYCORE_TLSF_ALLOCATOR_H
+#define ZYCORE_TLSF_ALLOCATOR_H
+
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The alignment (in bytes) of all memory blocks returned by the TLSF allocator.
+ */
+#define ZYAN_TLSF_ALIGNMENT             (2 * sizeof(void*))
+
+/**
+ * The binary logarithm of `ZYAN_TLSF_ALIGNMENT`.
+ */
+#define ZYAN_TLSF_ALIGNMENT_LOG2        ((sizeof(void*) == 8) ? 4 : 3)
+
+/**
+ * The binary logarithm of the number of second-level size classes per first-level size class.
+ */
+#define ZYAN_TLSF_SL_COUNT_LOG2         4
+
+/**
+ * The number of second-level size classes per first-level size class.
+ */
+#define ZYAN_TLSF_SL_COUNT              (1 << ZYAN_TLSF_SL_COUNT_LOG2)
+
+/**
+ * The binary logarithm of the smallest size covered by the first-level size classes.
+ *
+ * All smaller sizes share the first first-level size class.
+ */
+#define ZYAN_TLSF_FL_SHIFT              (ZYAN_TLSF_SL_COUNT_LOG2 + ZYAN_TLSF_ALIGNMENT_LOG2)
+
+/**
+ * The binary logarithm of the exclusive upper bound of the managed block sizes.
+ */
+#define ZYAN_TLSF_FL_INDEX_MAX          ((sizeof(void*) == 8) ? 32 : 30)
+
+/**
+ * The number of first-level size classes.
+ */
+#define ZYAN_TLSF_FL_COUNT              (ZYAN_TLSF_FL_INDEX_MAX - ZYAN_TLSF_FL_SHIFT + 1)
+
+/**
+ * The maximum size (in bytes) of a single memory block.
+ *
+ * Larger regions are truncated to this size.
+ */
+#define ZYAN_TLSF_MAX_BLOCK_SIZE \
+    (((ZyanUSize)1 << ZYAN_TLSF_FL_INDEX_MAX) - ZYAN_TLSF_ALIGNMENT)
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+struct ZyanTlsfBlock_;
+
+/**
+ * Defines the `ZyanTlsfAllocator` struct.
+ *
+ * The TLSF allocator manages one or more caller-provided memory regions and does not depend on
+ * any other allocator, which makes it usable as a general purpose allocator in `ZYAN_NO_LIBC`
+ * builds. Free blocks are kept in segregated free lists indexed by a two-level bitmap, so both
+ * allocation and deallocation run in constant time. Adjacent free blocks are merged immediately,
+ * which bounds the fragmentation.
+ *
+ * Pass a pointer to the `allocator` field to any of the `*InitEx` functions to use the TLSF
+ * allocator for a container instance. Allocations fail with
+ * `ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE`, if no free block is large enough.
+ *
+ * The allocator is not thread-safe. All fields in this struct should be considered as
+ * "private". Any changes may lead to unexpected behavior.
+ */
+typedef struct ZyanTlsfAllocator_
+{
+    /**
+     * The base allocator.
+     */
+    ZyanAllocator allocator;
+    /**
+     * The first-level bitmap. Bit `i` is set, if any free list of the first-level size class `i`
+     * is non-empty.
+     */
+    ZyanU32 fl_bitmap;
+    /**
+     * The second-level bitmaps. Bit `j` of entry `i` is set, if the free list `(i, j)` is
+     * non-empty.
+     */
+    ZyanU32 sl_bitmap[ZYAN_TLSF_FL_COUNT];
+    /**
+     * The heads of the segregated free lists.
+     */
+    struct ZyanTlsfBlock_* free_lists[ZYAN_TLSF_FL_COUNT][ZYAN_TLSF_SL_COUNT];
+} ZyanTlsfAllocator;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Initializes the given `ZyanTlsfAllocator` instance and adds the first memory region.
+ *
+ * @param   tlsf        A pointer to the `ZyanTlsfAllocator` instance.
+ * @param   buffer      A pointer to the memory region.
+ * @param   capacity    The size of the memory region (in bytes).
+ *
+ * @return  A zyan status code.
+ *
+ * The memory region must stay valid for the lifetime of the allocator.
+ *
+ * Finalization is not required for instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanTlsfInit(ZyanTlsfAllocator* tlsf, void* buffer,
+    ZyanUSize capacity);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Regions                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Adds another memory region to the given `ZyanTlsfAllocator` instance.
+ *
+ * @param   tlsf        A pointer to the `ZyanTlsfAllocator` instance.
+ * @param   buffer      A pointer to the memory region.
+ * @param   capacity    The size of the memory region (in bytes).
+ *
+ * @return  A zyan status code.
+ *
+ * The memory region must not overlap any other region of the allocator and must stay valid for
+ * the lifetime of the allocator. Memory blocks never span multiple regions.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanTlsfAddRegion(ZyanTlsfAllocator* tlsf, void* buffer,
+    ZyanUSize capacity);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_TLSF_ALLOCATOR_H */
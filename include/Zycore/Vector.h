@@ -62,10 +62,70 @@ extern "C" {
  */
 #define ZYAN_VECTOR_DEFAULT_SHRINK_THRESHOLD    4
 
+/**
+ * The default number of consecutive under-occupied removals before a vector with a growth policy
+ * shrinks.
+ */
+#define ZYAN_VECTOR_DEFAULT_SHRINK_DELAY        8
+
 /* ============================================================================================== */
 /* Enums and types                                                                                */
 /* ============================================================================================== */
 
+/**
+ * Defines the `ZyanVectorGrowthPolicy` struct.
+ *
+ * A growth policy replaces the integral `growth_factor` and `shrink_threshold` of a vector. It
+ * allows fractional growth factors, limits the size of a single growth step, rounds the capacity
+ * of large buffers to whole pages and only shrinks the vector after a sustained period of low
+ * occupancy.
+ *
+ * The same policy may be shared by multiple vectors and has to outlive all of them.
+ */
+typedef struct ZyanVectorGrowthPolicy_
+{
+    /**
+     * The numerator of the growth factor.
+     */
+    ZyanU16 growth_numerator;
+    /**
+     * The denominator of the growth factor.
+     */
+    ZyanU16 growth_denominator;
+    /**
+     * The maximum number of bytes added by a single growth step or `0` for no limit.
+     */
+    ZyanUSize max_growth_step;
+    /**
+     * The page size (in bytes) the capacity of large buffers is rounded up to or `0` to disable
+     * rounding.
+     */
+    ZyanUSize page_size;
+    /**
+     * The minimum buffer size (in bytes) for page-size rounding to apply.
+     */
+    ZyanUSize page_threshold;
+    /**
+     * The shrink threshold or `0` to disable dynamic shrinking.
+     */
+    ZyanU8 shrink_threshold;
+    /**
+     * The number of consecutive removals that have to leave the vector under-occupied, before it
+     * shrinks.
+     */
+    ZyanU8 shrink_delay;
+} ZyanVectorGrowthPolicy;
+
+/**
+ * Defines the `ZyanVectorPredicate` function prototype.
+ *
+ * @param   element     A pointer to the element.
+ * @param   user_data   The user data passed to the calling function.
+ *
+ * @return  `ZYAN_TRUE`, if the predicate holds for the element or `ZYAN_FALSE`, if not.
+ */
+typedef ZyanBool (*ZyanVectorPredicate)(const void* element, void* user_data);
+
 /**
  * Defines the `ZyanVector` struct.
  *
@@ -106,8 +166,42 @@ typedef struct ZyanVector_
      * The data pointer.
      */
     void* data;
+    /**
+     * The growth policy or `ZYAN_NULL`, if `growth_factor` and `shrink_threshold` are used.
+     */
+    const ZyanVectorGrowthPolicy* growth_policy;
+    /**
+     * The number of consecutive removals that left the vector under-occupied.
+     */
+    ZyanU8 shrink_pending;
 } ZyanVector;
 
+/**
+ * Defines the `ZyanSmallVector` struct.
+ *
+ * The `ZyanSmallVector` type is a `ZyanVector` with small-buffer optimization. The elements are
+ * stored in a caller-provided inline buffer, like `ZyanVectorInitCustomBuffer` does, and migrate
+ * transparently to allocator-backed storage once the buffer overflows.
+ *
+ * Pass a pointer to the `vector` field to any of the `ZyanVector*` functions to use the vector.
+ *
+ * The struct contains a pointer to itself and must not be copied or moved after initialization.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanSmallVector_
+{
+    /**
+     * The vector.
+     */
+    ZyanVector vector;
+    /**
+     * The allocator that hands out the inline buffer.
+     */
+    ZyanSmallBufferAllocator allocator;
+} ZyanSmallVector;
+
 /* ============================================================================================== */
 /* Macros                                                                                         */
 /* ============================================================================================== */
@@ -128,7 +222,9 @@ typedef struct ZyanVector_
         /* capacity         */ 0, \
         /* element_size     */ 0, \
         /* destructor       */ ZYAN_NULL, \
-        /* data             */ ZYAN_NULL \
+        /* data             */ ZYAN_NULL, \
+        /* growth_policy    */ ZYAN_NULL, \
+        /* shrink_pending   */ 0 \
     }
 
 /* ---------------------------------------------------------------------------------------------- */
@@ -198,6 +294,105 @@ typedef struct ZyanVector_
         } \
     }
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Typed vectors                                                                                  */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Declares a set of type-safe inline functions for `ZyanVector` instances with elements of the
+ * given `type`.
+ *
+ * @param   name    The common prefix of the generated functions.
+ * @param   type    The element type.
+ *
+ * The generated functions operate on regular `ZyanVector` instances with an `element_size` of
+ * `sizeof(type)` and can be freely mixed with all other `ZyanVector*` functions. As the element
+ * size is a compile-time constant, the compiler is able to inline and vectorize all element
+ * accesses. The following functions are generated:
+ *
+ * - `ZyanStatus <name>InitEx(ZyanVector* vector, ZyanUSize capacity, ZyanAllocator* allocator,
+ *   ZyanU8 growth_factor, ZyanU8 shrink_threshold)`
+ * - `const type* <name>Get(const ZyanVector* vector, ZyanUSize index)`
+ * - `type* <name>GetMutable(const ZyanVector* vector, ZyanUSize index)`
+ * - `ZyanStatus <name>Set(ZyanVector* vector, ZyanUSize index, const type* value)`
+ * - `ZyanStatus <name>PushBack(ZyanVector* vector, const type* element)`
+ * - `ZyanStatus <name>Find(const ZyanVector* vector, const type* element,
+ *   ZyanISize* found_index, ZyanEqualityComparison comparison)`
+ *
+ * `Get` and `GetMutable` do not perform any bounds checks in release builds. `PushBack` falls back
+ * to `ZyanVectorPushBack`, if the vector has to grow.
+ */
+#define ZYAN_DECLARE_TYPED_VECTOR(name, type) \
+    ZYAN_INLINE ZyanStatus name##InitEx(ZyanVector* vector, ZyanUSize capacity, \
+        ZyanAllocator* allocator, ZyanU8 growth_factor, ZyanU8 shrink_threshold) \
+    { \
+        return ZyanVectorInitEx(vector, sizeof(type), capacity, (ZyanMemberProcedure)ZYAN_NULL, \
+            allocator, growth_factor, shrink_threshold); \
+    } \
+    \
+    ZYAN_INLINE const type* name##Get(const ZyanVector* vector, ZyanUSize index) \
+    { \
+        ZYAN_ASSERT(vector && (vector->element_size == sizeof(type))); \
+        ZYAN_ASSERT(index < vector->size); \
+        return (const type*)vector->data + index; \
+    } \
+    \
+    ZYAN_INLINE type* name##GetMutable(const ZyanVector* vector, ZyanUSize index) \
+    { \
+        ZYAN_ASSERT(vector && (vector->element_size == sizeof(type))); \
+        ZYAN_ASSERT(index < vector->size); \
+        return (type*)vector->data + index; \
+    } \
+    \
+    ZYAN_INLINE ZyanStatus name##Set(ZyanVector* vector, ZyanUSize index, const type* value) \
+    { \
+        ZYAN_ASSERT(vector && (vector->element_size == sizeof(type))); \
+        ZYAN_ASSERT(value); \
+        if (index >= vector->size) \
+        { \
+            return ZYAN_STATUS_OUT_OF_RANGE; \
+        } \
+        type* const offset = (type*)vector->data + index; \
+        if (vector->destructor) \
+        { \
+            vector->destructor(offset); \
+        } \
+        *offset = *value; \
+        return ZYAN_STATUS_SUCCESS; \
+    } \
+    \
+    ZYAN_INLINE ZyanStatus name##PushBack(ZyanVector* vector, const type* element) \
+    { \
+        ZYAN_ASSERT(vector && (vector->element_size == sizeof(type))); \
+        ZYAN_ASSERT(element); \
+        if (vector->size >= vector->capacity) \
+        { \
+            return ZyanVectorPushBack(vector, element); \
+        } \
+        ((type*)vector->data)[vector->size++] = *element; \
+        return ZYAN_STATUS_SUCCESS; \
+    } \
+    \
+    ZYAN_INLINE ZyanStatus name##Find(const ZyanVector* vector, const type* element, \
+        ZyanISize* found_index, ZyanEqualityComparison comparison) \
+    { \
+        ZYAN_ASSERT(vector && (vector->element_size == sizeof(type))); \
+        ZYAN_ASSERT(element); \
+        ZYAN_ASSERT(found_index); \
+        ZYAN_ASSERT(comparison); \
+        const type* const data = (const type*)vector->data; \
+        for (ZyanUSize i = 0; i < vector->size; ++i) \
+        { \
+            if (comparison(&data[i], element)) \
+            { \
+                *found_index = (ZyanISize)i; \
+                return ZYAN_STATUS_TRUE; \
+            } \
+        } \
+        *found_index = -1; \
+        return ZYAN_STATUS_FALSE; \
+    }
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
@@ -229,6 +424,30 @@ typedef struct ZyanVector_
 ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanVectorInit(ZyanVector* vector,
     ZyanUSize element_size, ZyanUSize capacity, ZyanMemberProcedure destructor);
 
+/**
+ * Initializes the given `ZyanVector` instance and guarantees a minimum alignment for the
+ * element storage.
+ *
+ * @param   vector          A pointer to the `ZyanVector` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   capacity        The initial capacity (number of elements).
+ * @param   destructor      A destructor callback that is invoked every time an item is deleted, or
+ *                          `ZYAN_NULL` if not needed.
+ * @param   alignment       The alignment (in bytes) of the element storage. Must be a power of two
+ *                          not larger than `ZYAN_ALLOCATOR_MAX_DEFAULT_ALIGNMENT`.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the vector elements is dynamically allocated by the aligned default allocator
+ * (see `ZyanAllocatorDefaultAligned`) using the default growth factor and the default shrink
+ * threshold. The alignment is retained when the vector grows or shrinks.
+ *
+ * Finalization with `ZyanVectorDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanVectorInitAligned(ZyanVector* vector,
+    ZyanUSize element_size, ZyanUSize capacity, ZyanMemberProcedure destructor,
+    ZyanUSize alignment);
+
 #endif // ZYAN_NO_LIBC
 
 /**
@@ -273,6 +492,83 @@ ZYCORE_EXPORT ZyanStatus ZyanVectorInitEx(ZyanVector* vector, ZyanUSize element_
 ZYCORE_EXPORT ZyanStatus ZyanVectorInitCustomBuffer(ZyanVector* vector, ZyanUSize element_size,
     void* buffer, ZyanUSize capacity, ZyanMemberProcedure destructor);
 
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanVector` instance and configures it to use a reserved range of
+ * virtual memory that is committed on demand.
+ *
+ * @param   vector          A pointer to the `ZyanVector` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   max_capacity    The maximum capacity (number of elements). Address space for this
+ *                          amount of elements is reserved up front, but physical memory is only
+ *                          committed as the vector grows.
+ * @param   destructor      A destructor callback that is invoked every time an item is deleted, or
+ *                          `ZYAN_NULL` if not needed.
+ *
+ * @return  A zyan status code.
+ *
+ * The data of the vector never moves, which means that growing the vector never copies any
+ * elements and pointers to elements stay valid until the elements are removed. Memory is
+ * committed in steps of at least 64 KiB and `ZyanVectorShrinkToFit` returns unused pages to the
+ * system. Growing the vector beyond `max_capacity` fails with
+ * `ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE`.
+ *
+ * Finalization with `ZyanVectorDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanVectorInitVirtual(ZyanVector* vector,
+    ZyanUSize element_size, ZyanUSize max_capacity, ZyanMemberProcedure destructor);
+
+/**
+ * Initializes the given `ZyanSmallVector` instance.
+ *
+ * @param   vector          A pointer to the `ZyanSmallVector` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   buffer          A pointer to the inline buffer that is used as initial storage for the
+ *                          elements.
+ * @param   capacity        The capacity (number of elements) of the inline buffer.
+ * @param   destructor      A destructor callback that is invoked every time an item is deleted, or
+ *                          `ZYAN_NULL` if not needed.
+ *
+ * @return  A zyan status code.
+ *
+ * The vector spills to the default allocator using the default growth factor and the default
+ * shrink threshold.
+ *
+ * Finalization with `ZyanVectorDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanVectorInitSmall(ZyanSmallVector* vector,
+    ZyanUSize element_size, void* buffer, ZyanUSize capacity, ZyanMemberProcedure destructor);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanSmallVector` instance and sets a custom `allocator` and memory
+ * allocation/deallocation parameters.
+ *
+ * @param   vector              A pointer to the `ZyanSmallVector` instance.
+ * @param   element_size        The size of a single element in bytes.
+ * @param   buffer              A pointer to the inline buffer that is used as initial storage for
+ *                              the elements.
+ * @param   capacity            The capacity (number of elements) of the inline buffer.
+ * @param   destructor          A destructor callback that is invoked every time an item is
+ *                              deleted, or `ZYAN_NULL` if not needed.
+ * @param   allocator           A pointer to the `ZyanAllocator` instance used once the vector
+ *                              outgrows the inline buffer.
+ * @param   growth_factor       The growth factor.
+ * @param   shrink_threshold    The shrink threshold.
+ *
+ * @return  A zyan status code.
+ *
+ * A growth factor of `1` disables overallocation and a shrink threshold of `0` disables
+ * dynamic shrinking.
+ *
+ * Finalization with `ZyanVectorDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorInitSmallEx(ZyanSmallVector* vector, ZyanUSize element_size,
+    void* buffer, ZyanUSize capacity, ZyanMemberProcedure destructor, ZyanAllocator* allocator,
+    ZyanU8 growth_factor, ZyanU8 shrink_threshold);
+
 /**
  * Destroys the given `ZyanVector` instance.
  *
@@ -499,6 +795,24 @@ ZYCORE_EXPORT ZyanStatus ZyanVectorEmplace(ZyanVector* vector, void** element,
 ZYCORE_EXPORT ZyanStatus ZyanVectorEmplaceEx(ZyanVector* vector, ZyanUSize index,
     void** element, ZyanMemberFunction constructor);
 
+/**
+ * Inserts `count` uninitialized elements at the given `index` of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ * @param   index   The insert index.
+ * @param   count   The number of elements to insert.
+ * @param   first   Receives a pointer to the first new element.
+ *
+ * @return  A zyan status code.
+ *
+ * The vector is grown at most once and all subsequent elements are shifted in a single pass. The
+ * new elements are in undefined state and should be written through the returned pointer, before
+ * any other function is called on the vector. The pointer is invalidated by the next operation
+ * that changes the capacity of the vector.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorEmplaceRange(ZyanVector* vector, ZyanUSize index,
+    ZyanUSize count, void** first);
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Utils                                                                                          */
 /* ---------------------------------------------------------------------------------------------- */
@@ -544,6 +858,37 @@ ZYCORE_EXPORT ZyanStatus ZyanVectorDelete(ZyanVector* vector, ZyanUSize index);
 ZYCORE_EXPORT ZyanStatus ZyanVectorDeleteRange(ZyanVector* vector, ZyanUSize index,
     ZyanUSize count);
 
+/**
+ * Deletes the element at the given `index` of the vector by replacing it with the last element.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ * @param   index   The element index.
+ *
+ * @return  A zyan status code.
+ *
+ * This function runs in constant time, but does not preserve the order of the elements.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorDeleteUnordered(ZyanVector* vector, ZyanUSize index);
+
+/**
+ * Deletes all elements of the given vector that satisfy the `predicate`.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   predicate   The predicate function.
+ * @param   user_data   A user-defined pointer that is passed to the `predicate`.
+ *
+ * @return  A zyan status code.
+ *
+ * The remaining elements keep their relative order. The vector is compacted in a single pass and
+ * shrinks at most once, which makes this function run in linear time.
+ *
+ * The `predicate` is invoked exactly once for each element in ascending order. The destructor of
+ * a deleted element is invoked directly after its predicate returned `ZYAN_TRUE`. The `predicate`
+ * must not modify the vector.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorRemoveIf(ZyanVector* vector, ZyanVectorPredicate predicate,
+    void* user_data);
+
 /**
  * Removes the last element of the vector.
  *
@@ -562,6 +907,60 @@ ZYCORE_EXPORT ZyanStatus ZyanVectorPopBack(ZyanVector* vector);
  */
 ZYCORE_EXPORT ZyanStatus ZyanVectorClear(ZyanVector* vector);
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Sorting                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Sorts the elements of the given vector in ascending order.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   comparison  The comparison function to use.
+ *
+ * @return  A zyan status code.
+ *
+ * The elements are sorted in-place using a pattern-defeating introsort, which runs in
+ * `O(n log n)` for all inputs. The sort is not stable.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorSort(ZyanVector* vector, ZyanComparison comparison);
+
+/**
+ * Sorts the elements of the given vector in ascending order using multiple threads.
+ *
+ * @param   vector          A pointer to the `ZyanVector` instance.
+ * @param   comparison      The comparison function to use.
+ * @param   thread_count    The number of threads to use or `0` to use one thread per processor.
+ * @param   allocator       A pointer to the `ZyanAllocator` instance used to allocate a scratch
+ *                          buffer of the same size as the vector.
+ *
+ * @return  A zyan status code.
+ *
+ * The vector is split into one run per thread. The runs are sorted in parallel using the
+ * introsort of `ZyanVectorSort` and merged in `log2(thread_count)` passes, in which every thread
+ * merges an equally sized part of the output. The number of threads is capped at `64` and
+ * reduced for small vectors. The `comparison` function is called concurrently from all threads.
+ * The sort is not stable.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanVectorSortParallel(ZyanVector* vector,
+    ZyanComparison comparison, ZyanUSize thread_count, ZyanAllocator* allocator);
+
+/**
+ * Sorts the elements of the given vector in ascending order of an unsigned integer key.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   key_offset  The offset of the key inside an element (in bytes).
+ * @param   key_size    The size of the key (in bytes). Must be `1`, `2`, `4` or `8`.
+ *
+ * @return  A zyan status code.
+ *
+ * The key is read in native byte order. Larger vectors are sorted using a stable LSD radix sort
+ * with a scratch buffer obtained from the allocator of the vector. Vectors that were initialized
+ * with a custom buffer are sorted in-place using the introsort of `ZyanVectorSort` instead,
+ * which is not stable.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorSortByKey(ZyanVector* vector, ZyanUSize key_offset,
+    ZyanUSize key_size);
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Searching                                                                                      */
 /* ---------------------------------------------------------------------------------------------- */
@@ -600,6 +999,42 @@ ZYCORE_EXPORT ZyanStatus ZyanVectorFind(const ZyanVector* vector, const void* el
 ZYCORE_EXPORT ZyanStatus ZyanVectorFindEx(const ZyanVector* vector, const void* element,
     ZyanISize* found_index, ZyanEqualityComparison comparison, ZyanUSize index, ZyanUSize count);
 
+/**
+ * Sequentially searches for the first element that is bitwise equal to `element`.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   element     A pointer to the element to search for.
+ * @param   found_index A pointer to a variable that receives the index of the found element.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the element was found, `ZYAN_STATUS_FALSE` if not or a generic
+ *          zyan status code if an error occurred.
+ *
+ * The `found_index` is set to `-1`, if the element was not found.
+ *
+ * Unlike `ZyanVectorFind`, this function does not call a comparison function, but compares all
+ * `element_size` bytes (including the padding of structures). For element sizes of 1, 2, 4 and 8
+ * bytes, SSE2 or AVX2 is used on x86 processors that support it.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorFindBytes(const ZyanVector* vector, const void* element,
+    ZyanISize* found_index);
+
+/**
+ * Sequentially searches for the first element that is bitwise equal to `element`.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   element     A pointer to the element to search for.
+ * @param   found_index A pointer to a variable that receives the index of the found element.
+ * @param   index       The start index.
+ * @param   count       The maximum number of elements to iterate, beginning from the start `index`.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the element was found, `ZYAN_STATUS_FALSE` if not or a generic
+ *          zyan status code if an error occurred.
+ *
+ * The `found_index` is set to `-1`, if the element was not found.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorFindBytesEx(const ZyanVector* vector, const void* element,
+    ZyanISize* found_index, ZyanUSize index, ZyanUSize count);
+
 /**
  * Searches for the first occurrence of `element` in the given vector using a binary-
  * search algorithm.
@@ -642,6 +1077,115 @@ ZYCORE_EXPORT ZyanStatus ZyanVectorBinarySearch(const ZyanVector* vector, const
 ZYCORE_EXPORT ZyanStatus ZyanVectorBinarySearchEx(const ZyanVector* vector, const void* element,
     ZyanUSize* found_index, ZyanComparison comparison, ZyanUSize index, ZyanUSize count);
 
+/**
+ * Searches for the first occurrence of `element` in the given vector using a branchless binary-
+ * search algorithm.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   element     A pointer to the element to search for.
+ * @param   found_index A pointer to a variable that receives the index of the found element.
+ * @param   comparison  The comparison function to use.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the element was found, `ZYAN_STATUS_FALSE` if not or a generic
+ *          zyan status code if an error occurred.
+ *
+ * This function returns the same results as `ZyanVectorBinarySearch`, but performs a fixed
+ * number of comparisons, selects the next range without a conditional branch and prefetches both
+ * candidate midpoints of the next step. It is faster for large vectors that do not fit into the
+ * cache.
+ *
+ * This function requires all elements in the vector to be strictly ordered (sorted).
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorBinarySearchBranchless(const ZyanVector* vector,
+    const void* element, ZyanUSize* found_index, ZyanComparison comparison);
+
+/**
+ * Searches for the first occurrence of `element` in the given vector using a branchless binary-
+ * search algorithm.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   element     A pointer to the element to search for.
+ * @param   found_index A pointer to a variable that receives the index of the found element.
+ * @param   comparison  The comparison function to use.
+ * @param   index       The start index.
+ * @param   count       The maximum number of elements to iterate, beginning from the start `index`.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the element was found, `ZYAN_STATUS_FALSE` if not or a generic
+ *          zyan status code if an error occurred.
+ *
+ * See `ZyanVectorBinarySearchBranchless` for more information.
+ *
+ * This function requires all elements in the vector to be strictly ordered (sorted).
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorBinarySearchBranchlessEx(const ZyanVector* vector,
+    const void* element, ZyanUSize* found_index, ZyanComparison comparison, ZyanUSize index,
+    ZyanUSize count);
+
+/**
+ * Searches for multiple elements in the given vector at once.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   keys        A pointer to an array of `key_count` elements to search for. Each element
+ *                      has the element size of the vector.
+ * @param   key_count   The number of elements to search for.
+ * @param   out_indices A pointer to an array that receives `key_count` indices.
+ * @param   comparison  The comparison function to use.
+ *
+ * @return  A zyan status code.
+ *
+ * For each key, `out_indices` receives the index of the first entry that is not less than the
+ * key or the size of the vector, if there is no such entry. This equals the `found_index` of
+ * `ZyanVectorBinarySearch`. Compare the entry at the index with the key to check, if the key was
+ * found.
+ *
+ * If the keys are sorted, the vector is walked from left to right and each search gallops
+ * forward from the result of the previous key. Otherwise, groups of independent searches are
+ * executed in lockstep, which overlaps their cache misses.
+ *
+ * This function requires all elements in the vector to be strictly ordered (sorted).
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorBinarySearchBatch(const ZyanVector* vector, const void* keys,
+    ZyanUSize key_count, ZyanUSize* out_indices, ZyanComparison comparison);
+
+/**
+ * Stores the elements of a sorted vector in Eytzinger (breadth-first) order.
+ *
+ * @param   destination A pointer to the destination `ZyanVector` instance.
+ * @param   source      A pointer to the sorted source `ZyanVector` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * The elements are stored as an implicit binary search tree starting at index `1`, with the
+ * children of the element at index `k` at the indices `2k` and `2k + 1`. The element at index `0`
+ * is unused. The destination vector is resized to `n + 1` elements and must have the same element
+ * size as the source vector and no destructor. The elements are copied bytewise.
+ *
+ * The layout keeps the first levels of the tree in a few cache lines and allows prefetching
+ * multiple levels ahead, which makes `ZyanVectorEytzingerSearch` faster than a binary search for
+ * read-mostly tables.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorBuildEytzinger(ZyanVector* destination,
+    const ZyanVector* source);
+
+/**
+ * Searches for the first occurrence of `element` in a vector that was built by
+ * `ZyanVectorBuildEytzinger`.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   element     A pointer to the element to search for.
+ * @param   found_index A pointer to a variable that receives the index of the found element.
+ * @param   comparison  The comparison function to use.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the element was found, `ZYAN_STATUS_FALSE` if not or a generic
+ *          zyan status code if an error occurred.
+ *
+ * If found, `found_index` contains the index of `element` in the Eytzinger vector. If not found,
+ * `found_index` contains the index of the first entry larger than `element` or `0`, if there is
+ * no such entry.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorEytzingerSearch(const ZyanVector* vector,
+    const void* element, ZyanUSize* found_index, ZyanComparison comparison);
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Memory management                                                                              */
 /* ---------------------------------------------------------------------------------------------- */
@@ -687,6 +1231,34 @@ ZYCORE_EXPORT ZyanStatus ZyanVectorReserve(ZyanVector* vector, ZyanUSize capacit
  */
 ZYCORE_EXPORT ZyanStatus ZyanVectorShrinkToFit(ZyanVector* vector);
 
+/**
+ * Initializes the given `ZyanVectorGrowthPolicy` instance with the default values.
+ *
+ * @param   policy  A pointer to the `ZyanVectorGrowthPolicy` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * The default policy grows by a factor of `1.5`, does not limit the growth step, rounds buffers
+ * of `64 KiB` and above to `4 KiB` pages and shrinks to a quarter of the capacity after
+ * `ZYAN_VECTOR_DEFAULT_SHRINK_DELAY` consecutive under-occupied removals.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorGrowthPolicyInit(ZyanVectorGrowthPolicy* policy);
+
+/**
+ * Sets the growth policy of the given `ZyanVector` instance.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ * @param   policy  A pointer to the `ZyanVectorGrowthPolicy` instance or `ZYAN_NULL` to restore
+ *                  the `growth_factor` and `shrink_threshold` based behavior.
+ *
+ * @return  A zyan status code.
+ *
+ * The vector only stores a pointer to the policy, which has to outlive the vector. The growth
+ * factor must be at least `1`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorSetGrowthPolicy(ZyanVector* vector,
+    const ZyanVectorGrowthPolicy* policy);
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Information                                                                                    */
 /* ---------------------------------------------------------------------------------------------- */
@@ -713,6 +1285,93 @@ ZYCORE_EXPORT ZyanStatus ZyanVectorGetSize(const ZyanVector* vector, ZyanUSize*
 
 /* ---------------------------------------------------------------------------------------------- */
 
+/* ============================================================================================== */
+/* Inline fast paths                                                                              */
+/* ============================================================================================== */
+
+#ifdef ZYCORE_INLINE_FASTPATH
+
+#include <Zycore/LibC.h>
+
+/*
+ * With `ZYCORE_INLINE_FASTPATH` defined, calls to the trivial accessors and the common case of
+ * `ZyanVectorPushBack` are replaced by the inline implementations below, which avoids the call
+ * through the PLT in shared library builds. The exported functions remain available for ABI
+ * compatibility and can still be called explicitly by taking their address.
+ */
+
+ZYAN_INLINE const void* ZyanVectorGetInline(const ZyanVector* vector, ZyanUSize index)
+{
+    if (!vector || (index >= vector->size))
+    {
+        return ZYAN_NULL;
+    }
+
+    return (const ZyanU8*)vector->data + index * vector->element_size;
+}
+
+ZYAN_INLINE void* ZyanVectorGetMutableInline(const ZyanVector* vector, ZyanUSize index)
+{
+    if (!vector || (index >= vector->size))
+    {
+        return ZYAN_NULL;
+    }
+
+    return (ZyanU8*)vector->data + index * vector->element_size;
+}
+
+ZYAN_INLINE ZyanStatus ZyanVectorPushBackInline(ZyanVector* vector, const void* element)
+{
+    if (!vector || !element || (vector->size >= vector->capacity))
+    {
+        return ZyanVectorPushBack(vector, element);
+    }
+
+    ZYAN_MEMCPY((ZyanU8*)vector->data + vector->size * vector->element_size, element,
+        vector->element_size);
+    ++vector->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZYAN_INLINE ZyanStatus ZyanVectorGetCapacityInline(const ZyanVector* vector,
+    ZyanUSize* capacity)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *capacity = vector->capacity;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZYAN_INLINE ZyanStatus ZyanVectorGetSizeInline(const ZyanVector* vector, ZyanUSize* size)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = vector->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+#define ZyanVectorGet(vector, index) \
+    ZyanVectorGetInline(vector, index)
+#define ZyanVectorGetMutable(vector, index) \
+    ZyanVectorGetMutableInline(vector, index)
+#define ZyanVectorPushBack(vector, element) \
+    ZyanVectorPushBackInline(vector, element)
+#define ZyanVectorGetCapacity(vector, capacity) \
+    ZyanVectorGetCapacityInline(vector, capacity)
+#define ZyanVectorGetSize(vector, size) \
+    ZyanVectorGetSizeInline(vector, size)
+
+#endif // ZYCORE_INLINE_FASTPATH
+
 /* ============================================================================================== */
 
 #ifdef __cplusplus
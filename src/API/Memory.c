@@ -32,10 +32,77 @@
 
 #elif defined(ZYAN_POSIX)
 #   include <unistd.h>
+#   if defined(ZYAN_LINUX)
+#       include <fcntl.h>
+#       include <Zycore/LibC.h>
+#   endif
+#   if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#       define MAP_ANONYMOUS MAP_ANON
+#   endif
+#   ifndef MAP_NORESERVE
+#       define MAP_NORESERVE 0
+#   endif
 #else
 #   error "Unsupported platform detected"
 #endif
 
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+#if defined(ZYAN_LINUX)
+
+/**
+ * Reads a decimal number from a system file.
+ *
+ * @param   path    The path of the file.
+ * @param   key     The key that precedes the number or `ZYAN_NULL`, if the number is located at
+ *                  the start of the file.
+ *
+ * @return  The parsed number or `0`, if the file or the key could not be found.
+ */
+static ZyanUSize ZyanMemoryReadSystemValue(const char* path, const char* key)
+{
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return 0;
+    }
+    char buffer[4096];
+    const ssize_t count = read(fd, buffer, sizeof(buffer) - 1);
+    close(fd);
+    if (count <= 0)
+    {
+        return 0;
+    }
+    buffer[count] = '\0';
+
+    const char* c = buffer;
+    if (key)
+    {
+        c = ZYAN_STRSTR(buffer, key);
+        if (!c)
+        {
+            return 0;
+        }
+        c += ZYAN_STRLEN(key);
+    }
+    while (*c == ' ')
+    {
+        ++c;
+    }
+
+    ZyanUSize value = 0;
+    while ((*c >= '0') && (*c <= '9'))
+    {
+        value = value * 10 + (ZyanUSize)(*c++ - '0');
+    }
+
+    return value;
+}
+
+#endif
+
 /* ============================================================================================== */
 /* Exported functions                                                                             */
 /* ============================================================================================== */
@@ -76,10 +143,239 @@ ZyanU32 ZyanMemoryGetSystemAllocationGranularity(void)
 #endif
 }
 
+ZyanUSize ZyanMemoryGetLargePageSize(void)
+{
+#if defined(ZYAN_WINDOWS)
+
+    return GetLargePageMinimum();
+
+#elif defined(ZYAN_LINUX)
+
+    // The value is cached (biased by one to tell "unsupported" apart from "not yet read") to
+    // avoid reading the files on every large page allocation. Racing threads store the same
+    // value, so a lost update is harmless
+    static ZyanUSize volatile cached = 0;
+    const ZyanUSize value = cached;
+    if (value)
+    {
+        return value - 1;
+    }
+
+    ZyanUSize size = ZyanMemoryReadSystemValue(
+        "/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", ZYAN_NULL);
+    if (!size)
+    {
+        // `/proc/meminfo` reports the size in KiB
+        size = ZyanMemoryReadSystemValue("/proc/meminfo", "Hugepagesize:") * 1024;
+    }
+
+    cached = size + 1;
+    return size;
+
+#else
+
+    return 0;
+
+#endif
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Memory management                                                                              */
 /* ---------------------------------------------------------------------------------------------- */
 
+ZyanStatus ZyanMemoryVirtualAllocate(void** address, ZyanUSize size,
+    ZyanMemoryPageProtection protection)
+{
+    if (!address || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+#if defined(ZYAN_WINDOWS)
+
+    void* const result = VirtualAlloc(ZYAN_NULL, size, MEM_RESERVE | MEM_COMMIT, protection);
+    if (!result)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+#elif defined(ZYAN_POSIX)
+
+    void* const result = mmap(ZYAN_NULL, size, protection, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (result == MAP_FAILED)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+#endif
+
+    *address = result;
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanMemoryVirtualAllocateLarge(void** address, ZyanUSize* size,
+    ZyanMemoryPageProtection protection)
+{
+    if (!address || !size || !*size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize large_page_size = ZyanMemoryGetLargePageSize();
+    if (!large_page_size || !ZYAN_IS_POWER_OF_2(large_page_size))
+    {
+        *size = ZYAN_ALIGN_UP(*size, (ZyanUSize)ZyanMemoryGetSystemPageSize());
+        ZYAN_CHECK(ZyanMemoryVirtualAllocate(address, *size, protection));
+        return ZYAN_STATUS_FALSE;
+    }
+    const ZyanUSize aligned_size = ZYAN_ALIGN_UP(*size, large_page_size);
+
+#if defined(ZYAN_WINDOWS)
+
+    void* const result = VirtualAlloc(ZYAN_NULL, aligned_size,
+        MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, protection);
+    if (result)
+    {
+        *address = result;
+        *size = aligned_size;
+        return ZYAN_STATUS_TRUE;
+    }
+
+    // Large pages require the `SeLockMemoryPrivilege` privilege
+    ZYAN_CHECK(ZyanMemoryVirtualAllocate(address, aligned_size, protection));
+    *size = aligned_size;
+
+    return ZYAN_STATUS_FALSE;
+
+#elif defined(ZYAN_POSIX)
+
+#   ifdef MAP_HUGETLB
+    // Most systems do not reserve a `hugetlbfs` pool, so after the first failure we skip the
+    // system call and directly fall back to transparent huge pages
+    static ZyanBool volatile hugetlb_unavailable = ZYAN_FALSE;
+    if (!hugetlb_unavailable)
+    {
+        void* const result = mmap(ZYAN_NULL, aligned_size, protection,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (result != MAP_FAILED)
+        {
+            *address = result;
+            *size = aligned_size;
+            return ZYAN_STATUS_TRUE;
+        }
+        hugetlb_unavailable = ZYAN_TRUE;
+    }
+#   endif
+
+    // Transparent huge pages are only used for naturally aligned ranges, so we over-allocate by
+    // one large page and trim the unaligned head and tail
+    const ZyanUSize raw_size = aligned_size + large_page_size;
+    ZyanU8* const raw = mmap(ZYAN_NULL, raw_size, protection, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if ((void*)raw == MAP_FAILED)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+    ZyanU8* const aligned = (ZyanU8*)ZYAN_ALIGN_UP((ZyanUPointer)raw, large_page_size);
+    const ZyanUSize head = (ZyanUSize)(aligned - raw);
+    const ZyanUSize tail = raw_size - head - aligned_size;
+    if (head)
+    {
+        munmap(raw, head);
+    }
+    if (tail)
+    {
+        munmap(aligned + aligned_size, tail);
+    }
+
+#   ifdef MADV_HUGEPAGE
+    // This is only a hint, so failures (e.g. transparent huge pages being disabled) are ignored
+    madvise(aligned, aligned_size, MADV_HUGEPAGE);
+#   endif
+
+    *address = aligned;
+    *size = aligned_size;
+
+    return ZYAN_STATUS_FALSE;
+
+#endif
+}
+
+ZyanStatus ZyanMemoryVirtualReserve(void** address, ZyanUSize size)
+{
+    if (!address || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+#if defined(ZYAN_WINDOWS)
+
+    void* const result = VirtualAlloc(ZYAN_NULL, size, MEM_RESERVE, PAGE_NOACCESS);
+    if (!result)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+#elif defined(ZYAN_POSIX)
+
+    void* const result = mmap(ZYAN_NULL, size, PROT_NONE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (result == MAP_FAILED)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+#endif
+
+    *address = result;
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanMemoryVirtualCommit(void* address, ZyanUSize size,
+    ZyanMemoryPageProtection protection)
+{
+#if defined(ZYAN_WINDOWS)
+
+    if (!VirtualAlloc(address, size, MEM_COMMIT, protection))
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+#elif defined(ZYAN_POSIX)
+
+    if (mprotect(address, size, protection))
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+#endif
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanMemoryVirtualDecommit(void* address, ZyanUSize size)
+{
+#if defined(ZYAN_WINDOWS)
+
+    if (!VirtualFree(address, size, MEM_DECOMMIT))
+    {
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+#elif defined(ZYAN_POSIX)
+
+    // Replacing the pages with a fresh inaccessible mapping releases the physical memory and the
+    // commit charge in a single call, while keeping the address range reserved
+    if (mmap(address, size, PROT_NONE, MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+        -1, 0) == MAP_FAILED)
+    {
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+#endif
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
 ZyanStatus ZyanMemoryVirtualProtect(void* address, ZyanUSize size, 
     ZyanMemoryPageProtection protection)
 {
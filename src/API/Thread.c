@@ -28,6 +28,29 @@
 
 #ifndef ZYAN_NO_LIBC
 
+#include <Zycore/LibC.h>
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanThreadStartContext` struct.
+ *
+ * The context is allocated by `ZyanThreadCreate` and released by the new thread.
+ */
+typedef struct ZyanThreadStartContext_
+{
+    /**
+     * The thread procedure.
+     */
+    ZyanThreadProcedure procedure;
+    /**
+     * The argument to pass to the thread procedure.
+     */
+    void* argument;
+} ZyanThreadStartContext;
+
 /* ============================================================================================== */
 /* Internal functions                                                                             */
 /* ============================================================================================== */
@@ -93,6 +116,7 @@ FlsFree(
 #if   defined(ZYAN_POSIX)
 
 #include <errno.h>
+#include <unistd.h>
 
 /* ---------------------------------------------------------------------------------------------- */
 /* General                                                                                        */
@@ -116,6 +140,74 @@ ZyanStatus ZyanThreadGetCurrentThreadId(ZyanThreadId* thread_id)
     return ZYAN_STATUS_SUCCESS;
 }
 
+/**
+ * Invokes the thread procedure of a thread created by `ZyanThreadCreate`.
+ *
+ * @param   parameter   A pointer to the `ZyanThreadStartContext` struct.
+ *
+ * @return  Always `NULL`.
+ */
+static void* ZyanThreadStart(void* parameter)
+{
+    const ZyanThreadStartContext context = *(ZyanThreadStartContext*)parameter;
+    ZYAN_FREE(parameter);
+
+    context.procedure(context.argument);
+
+    return NULL;
+}
+
+ZyanStatus ZyanThreadCreate(ZyanThread* thread, ZyanThreadProcedure procedure, void* argument)
+{
+    if (!thread || !procedure)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanThreadStartContext* const context = ZYAN_MALLOC(sizeof(ZyanThreadStartContext));
+    if (!context)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+    context->procedure = procedure;
+    context->argument  = argument;
+
+    const int error = pthread_create(thread, NULL, &ZyanThreadStart, context);
+    if (error != 0)
+    {
+        ZYAN_FREE(context);
+        if (error == EAGAIN)
+        {
+            return ZYAN_STATUS_OUT_OF_RESOURCES;
+        }
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanThreadJoin(ZyanThread thread)
+{
+    return !pthread_join(thread, NULL) ? ZYAN_STATUS_SUCCESS : ZYAN_STATUS_BAD_SYSTEMCALL;
+}
+
+ZyanStatus ZyanThreadGetProcessorCount(ZyanU32* count)
+{
+    if (!count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const long value = sysconf(_SC_NPROCESSORS_ONLN);
+    if (value < 1)
+    {
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+    *count = (ZyanU32)value;
+    return ZYAN_STATUS_SUCCESS;
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Thread Local Storage                                                                           */
 /* ---------------------------------------------------------------------------------------------- */
@@ -190,6 +282,73 @@ ZyanStatus ZyanThreadGetCurrentThreadId(ZyanThreadId* thread_id)
     return ZYAN_STATUS_SUCCESS;
 }
 
+/**
+ * Invokes the thread procedure of a thread created by `ZyanThreadCreate`.
+ *
+ * @param   parameter   A pointer to the `ZyanThreadStartContext` struct.
+ *
+ * @return  Always `0`.
+ */
+static DWORD WINAPI ZyanThreadStart(LPVOID parameter)
+{
+    const ZyanThreadStartContext context = *(ZyanThreadStartContext*)parameter;
+    ZYAN_FREE(parameter);
+
+    context.procedure(context.argument);
+
+    return 0;
+}
+
+ZyanStatus ZyanThreadCreate(ZyanThread* thread, ZyanThreadProcedure procedure, void* argument)
+{
+    if (!thread || !procedure)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanThreadStartContext* const context = ZYAN_MALLOC(sizeof(ZyanThreadStartContext));
+    if (!context)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+    context->procedure = procedure;
+    context->argument  = argument;
+
+    const HANDLE handle = CreateThread(NULL, 0, &ZyanThreadStart, context, 0, NULL);
+    if (!handle)
+    {
+        ZYAN_FREE(context);
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+    *thread = handle;
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanThreadJoin(ZyanThread thread)
+{
+    if (WaitForSingleObject(thread, INFINITE) != WAIT_OBJECT_0)
+    {
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+    return CloseHandle(thread) ? ZYAN_STATUS_SUCCESS : ZYAN_STATUS_BAD_SYSTEMCALL;
+}
+
+ZyanStatus ZyanThreadGetProcessorCount(ZyanU32* count)
+{
+    if (!count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+
+    *count = (ZyanU32)info.dwNumberOfProcessors;
+    return ZYAN_STATUS_SUCCESS;
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Thread Local Storage (TLS)                                                                     */
 /* ---------------------------------------------------------------------------------------------- */
@@ -27,6 +27,40 @@
 #include <Zycore/Allocator.h>
 #include <Zycore/LibC.h>
 
+#ifndef ZYAN_NO_LIBC
+#   include <Zycore/API/Memory.h>
+#   if defined(ZYAN_WINDOWS)
+#       include <malloc.h>
+#   endif
+#endif
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * The size of the header in front of each block returned by the aligned allocator (in bytes).
+ */
+#define ZYCORE_ALIGNED_HEADER_SIZE  (2 * sizeof(ZyanUSize))
+
+/**
+ * Returns the size (in bytes) of the backing memory block required for an aligned memory block.
+ *
+ * @param   size        The size of the aligned memory block (in bytes).
+ * @param   alignment   The alignment (in bytes).
+ *
+ * @return  The size (in bytes) of the backing memory block.
+ */
+#define ZYCORE_ALIGNED_TOTAL_SIZE(size, alignment) \
+    ((size) + ZYCORE_ALIGNED_HEADER_SIZE + (alignment) - 1)
+
+/**
+ * The size of the header in front of each block returned by the large page allocator (in bytes).
+ *
+ * The header stores the size of the underlying memory mapping.
+ */
+#define ZYCORE_LARGE_PAGE_HEADER_SIZE   (2 * sizeof(ZyanUSize))
+
 /* ============================================================================================== */
 /* Internal functions                                                                             */
 /* ============================================================================================== */
@@ -93,8 +127,365 @@ static ZyanStatus ZyanAllocatorDefaultDeallocate(ZyanAllocator* allocator, void*
     return ZYAN_STATUS_SUCCESS;
 }
 
+#if defined(ZYAN_WINDOWS)
+
+static ZyanStatus ZyanAllocatorDefaultExpand(ZyanAllocator* allocator, void* p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(allocator);
+
+    return _expand(p, element_size * n) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+#   define ZYCORE_ALLOCATOR_DEFAULT_EXPAND &ZyanAllocatorDefaultExpand
+#else
+#   define ZYCORE_ALLOCATOR_DEFAULT_EXPAND ZYAN_NULL
+#endif
+
+/**
+ * The default allocator instance.
+ */
+static ZyanAllocator ZyanAllocatorDefaultInstance =
+{
+    &ZyanAllocatorDefaultAllocate,
+    &ZyanAllocatorDefaultReallocate,
+    &ZyanAllocatorDefaultDeallocate,
+    ZYCORE_ALLOCATOR_DEFAULT_EXPAND
+};
+
+#endif // ZYAN_NO_LIBC
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Large page allocator                                                                           */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+static ZyanStatus ZyanAllocatorLargePageAllocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(allocator);
+
+    ZyanUSize size = ZYCORE_LARGE_PAGE_HEADER_SIZE + element_size * n;
+    void* raw;
+    ZYAN_CHECK(ZyanMemoryVirtualAllocateLarge(&raw, &size, ZYAN_PAGE_READWRITE));
+
+    *(ZyanUSize*)raw = size;
+    *p = (ZyanU8*)raw + ZYCORE_LARGE_PAGE_HEADER_SIZE;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanAllocatorLargePageDeallocate(ZyanAllocator* allocator, void* p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(allocator);
+    ZYAN_UNUSED(element_size);
+    ZYAN_UNUSED(n);
+
+    ZyanU8* const raw = (ZyanU8*)p - ZYCORE_LARGE_PAGE_HEADER_SIZE;
+
+    return ZyanMemoryVirtualFree(raw, *(ZyanUSize*)raw);
+}
+
+static ZyanStatus ZyanAllocatorLargePageExpand(ZyanAllocator* allocator, void* p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(allocator);
+
+    const ZyanUSize mapped = *(ZyanUSize*)((ZyanU8*)p - ZYCORE_LARGE_PAGE_HEADER_SIZE);
+
+    return (ZYCORE_LARGE_PAGE_HEADER_SIZE + element_size * n <= mapped) ?
+        ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+static ZyanStatus ZyanAllocatorLargePageReallocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    if (!*p)
+    {
+        return ZyanAllocatorLargePageAllocate(allocator, p, element_size, n);
+    }
+
+    const ZyanStatus status = ZyanAllocatorLargePageExpand(allocator, *p, element_size, n);
+    if (status == ZYAN_STATUS_TRUE)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    const ZyanUSize mapped = *(ZyanUSize*)((ZyanU8*)*p - ZYCORE_LARGE_PAGE_HEADER_SIZE);
+    void* block;
+    ZYAN_CHECK(ZyanAllocatorLargePageAllocate(allocator, &block, element_size, n));
+    ZYAN_MEMCPY(block, *p, mapped - ZYCORE_LARGE_PAGE_HEADER_SIZE);
+    ZYAN_CHECK(ZyanAllocatorLargePageDeallocate(allocator, *p, element_size, n));
+    *p = block;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * The large page allocator instance.
+ */
+static ZyanAllocator ZyanAllocatorLargePageInstance =
+{
+    &ZyanAllocatorLargePageAllocate,
+    &ZyanAllocatorLargePageReallocate,
+    &ZyanAllocatorLargePageDeallocate,
+    &ZyanAllocatorLargePageExpand
+};
+
 #endif // ZYAN_NO_LIBC
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Aligned allocator                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Aligns the given backing memory block and writes the block header.
+ *
+ * @param   raw         A pointer to the backing memory block.
+ * @param   size        The size of the aligned memory block (in bytes).
+ * @param   alignment   The alignment (in bytes).
+ *
+ * @return  A pointer to the aligned memory block.
+ */
+static void* ZyanAlignedAllocatorPlace(ZyanU8* raw, ZyanUSize size, ZyanUSize alignment)
+{
+    ZYAN_ASSERT(raw);
+
+    ZyanU8* const p = (ZyanU8*)ZYAN_ALIGN_UP(
+        (ZyanUPointer)raw + ZYCORE_ALIGNED_HEADER_SIZE, alignment);
+    ZyanUSize* const header = (ZyanUSize*)(p - ZYCORE_ALIGNED_HEADER_SIZE);
+    header[0] = (ZyanUSize)(p - raw);
+    header[1] = size;
+
+    return p;
+}
+
+static ZyanStatus ZyanAlignedAllocatorAllocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    const ZyanAlignedAllocator* const aligned = (const ZyanAlignedAllocator*)allocator;
+    const ZyanUSize size = element_size * n;
+
+    void* raw;
+    ZYAN_CHECK(aligned->backing->allocate(aligned->backing, &raw, sizeof(ZyanU8),
+        ZYCORE_ALIGNED_TOTAL_SIZE(size, aligned->alignment)));
+    *p = ZyanAlignedAllocatorPlace((ZyanU8*)raw, size, aligned->alignment);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanAlignedAllocatorReallocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    if (!*p)
+    {
+        return ZyanAlignedAllocatorAllocate(allocator, p, element_size, n);
+    }
+
+    const ZyanAlignedAllocator* const aligned = (const ZyanAlignedAllocator*)allocator;
+    const ZyanUSize size = element_size * n;
+
+    const ZyanUSize* const header = (const ZyanUSize*)((ZyanU8*)*p - ZYCORE_ALIGNED_HEADER_SIZE);
+    const ZyanUSize old_offset = header[0];
+    const ZyanUSize old_size = header[1];
+
+    void* raw = (ZyanU8*)*p - old_offset;
+    ZYAN_CHECK(aligned->backing->reallocate(aligned->backing, &raw, sizeof(ZyanU8),
+        ZYCORE_ALIGNED_TOTAL_SIZE(size, aligned->alignment)));
+
+    // The backing allocator might have moved the block to an address with a different alignment
+    // offset, in which case the data has to be moved inside the block
+    ZyanU8* const data = (ZyanU8*)ZYAN_ALIGN_UP(
+        (ZyanUPointer)raw + ZYCORE_ALIGNED_HEADER_SIZE, aligned->alignment);
+    if ((ZyanUSize)(data - (ZyanU8*)raw) != old_offset)
+    {
+        ZYAN_MEMMOVE(data, (ZyanU8*)raw + old_offset, ZYAN_MIN(old_size, size));
+    }
+    *p = ZyanAlignedAllocatorPlace((ZyanU8*)raw, size, aligned->alignment);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanAlignedAllocatorExpand(ZyanAllocator* allocator, void* p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    const ZyanAlignedAllocator* const aligned = (const ZyanAlignedAllocator*)allocator;
+    if (!aligned->backing->expand)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    const ZyanUSize size = element_size * n;
+    ZyanUSize* const header = (ZyanUSize*)((ZyanU8*)p - ZYCORE_ALIGNED_HEADER_SIZE);
+
+    const ZyanStatus status = aligned->backing->expand(aligned->backing, (ZyanU8*)p - header[0],
+        sizeof(ZyanU8), ZYCORE_ALIGNED_TOTAL_SIZE(size, aligned->alignment));
+    if (status == ZYAN_STATUS_TRUE)
+    {
+        header[1] = size;
+    }
+
+    return status;
+}
+
+static ZyanStatus ZyanAlignedAllocatorDeallocate(ZyanAllocator* allocator, void* p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(element_size);
+    ZYAN_UNUSED(n);
+
+    const ZyanAlignedAllocator* const aligned = (const ZyanAlignedAllocator*)allocator;
+
+    const ZyanUSize* const header = (const ZyanUSize*)((ZyanU8*)p - ZYCORE_ALIGNED_HEADER_SIZE);
+    return aligned->backing->deallocate(aligned->backing, (ZyanU8*)p - header[0], sizeof(ZyanU8),
+        ZYCORE_ALIGNED_TOTAL_SIZE(header[1], aligned->alignment));
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Small buffer allocator                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+static ZyanStatus ZyanSmallBufferAllocatorAllocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanSmallBufferAllocator* const small = (ZyanSmallBufferAllocator*)allocator;
+
+    if (!small->in_use && (element_size * n <= small->capacity))
+    {
+        small->in_use = ZYAN_TRUE;
+        *p = small->buffer;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    return small->backing->allocate(small->backing, p, element_size, n);
+}
+
+static ZyanStatus ZyanSmallBufferAllocatorReallocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanSmallBufferAllocator* const small = (ZyanSmallBufferAllocator*)allocator;
+
+    if (!*p)
+    {
+        return ZyanSmallBufferAllocatorAllocate(allocator, p, element_size, n);
+    }
+    if (*p != small->buffer)
+    {
+        return small->backing->reallocate(small->backing, p, element_size, n);
+    }
+    if (element_size * n <= small->capacity)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // Migrate the contents of the inline buffer to the backing allocator
+    void* x;
+    ZYAN_CHECK(small->backing->allocate(small->backing, &x, element_size, n));
+    ZYAN_MEMCPY(x, small->buffer, small->capacity);
+    small->in_use = ZYAN_FALSE;
+    *p = x;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanSmallBufferAllocatorExpand(ZyanAllocator* allocator, void* p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanSmallBufferAllocator* const small = (ZyanSmallBufferAllocator*)allocator;
+
+    if (p == small->buffer)
+    {
+        return (element_size * n <= small->capacity) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+    }
+    if (!small->backing->expand)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    return small->backing->expand(small->backing, p, element_size, n);
+}
+
+static ZyanStatus ZyanSmallBufferAllocatorDeallocate(ZyanAllocator* allocator, void* p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanSmallBufferAllocator* const small = (ZyanSmallBufferAllocator*)allocator;
+
+    if (p == small->buffer)
+    {
+        small->in_use = ZYAN_FALSE;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    return small->backing->deallocate(small->backing, p, element_size, n);
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
@@ -103,6 +494,13 @@ static ZyanStatus ZyanAllocatorDefaultDeallocate(ZyanAllocator* allocator, void*
 
 ZyanStatus ZyanAllocatorInit(ZyanAllocator* allocator, ZyanAllocatorAllocate allocate,
     ZyanAllocatorAllocate reallocate, ZyanAllocatorDeallocate deallocate)
+{
+    return ZyanAllocatorInitEx(allocator, allocate, reallocate, deallocate, ZYAN_NULL);
+}
+
+ZyanStatus ZyanAllocatorInitEx(ZyanAllocator* allocator, ZyanAllocatorAllocate allocate,
+    ZyanAllocatorAllocate reallocate, ZyanAllocatorDeallocate deallocate,
+    ZyanAllocatorExpand expand)
 {
     if (!allocator || !allocate || !reallocate || !deallocate)
     {
@@ -112,6 +510,45 @@ ZyanStatus ZyanAllocatorInit(ZyanAllocator* allocator, ZyanAllocatorAllocate all
     allocator->allocate   = allocate;
     allocator->reallocate = reallocate;
     allocator->deallocate = deallocate;
+    allocator->expand     = expand;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanAlignedAllocatorInit(ZyanAlignedAllocator* allocator, ZyanUSize alignment,
+    ZyanAllocator* backing)
+{
+    if (!allocator || !alignment || !ZYAN_IS_POWER_OF_2(alignment) || !backing)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanAllocatorInitEx(&allocator->allocator, &ZyanAlignedAllocatorAllocate,
+        &ZyanAlignedAllocatorReallocate, &ZyanAlignedAllocatorDeallocate,
+        &ZyanAlignedAllocatorExpand));
+
+    allocator->backing   = backing;
+    allocator->alignment = ZYAN_MAX(alignment, ZYCORE_ALIGNED_HEADER_SIZE);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSmallBufferAllocatorInit(ZyanSmallBufferAllocator* allocator, void* buffer,
+    ZyanUSize capacity, ZyanAllocator* backing)
+{
+    if (!allocator || !buffer || !capacity || !backing)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanAllocatorInitEx(&allocator->allocator, &ZyanSmallBufferAllocatorAllocate,
+        &ZyanSmallBufferAllocatorReallocate, &ZyanSmallBufferAllocatorDeallocate,
+        &ZyanSmallBufferAllocatorExpand));
+
+    allocator->backing  = backing;
+    allocator->buffer   = buffer;
+    allocator->capacity = capacity;
+    allocator->in_use   = ZYAN_FALSE;
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -120,13 +557,55 @@ ZyanStatus ZyanAllocatorInit(ZyanAllocator* allocator, ZyanAllocatorAllocate all
 
 ZyanAllocator* ZyanAllocatorDefault(void)
 {
-    static ZyanAllocator allocator =
+    return &ZyanAllocatorDefaultInstance;
+}
+
+ZyanAllocator* ZyanAllocatorDefaultAligned(ZyanUSize alignment)
+{
+#   define ZYCORE_ALIGNED_DEFAULT(alignment) \
+    { \
+        { \
+            &ZyanAlignedAllocatorAllocate, \
+            &ZyanAlignedAllocatorReallocate, \
+            &ZyanAlignedAllocatorDeallocate, \
+            &ZyanAlignedAllocatorExpand \
+        }, \
+        &ZyanAllocatorDefaultInstance, \
+        ZYAN_MAX(alignment, ZYCORE_ALIGNED_HEADER_SIZE) \
+    }
+
+    static ZyanAlignedAllocator allocators[] =
     {
-        &ZyanAllocatorDefaultAllocate,
-        &ZyanAllocatorDefaultReallocate,
-        &ZyanAllocatorDefaultDeallocate
+        ZYCORE_ALIGNED_DEFAULT(   1), ZYCORE_ALIGNED_DEFAULT(   2), ZYCORE_ALIGNED_DEFAULT(   4),
+        ZYCORE_ALIGNED_DEFAULT(   8), ZYCORE_ALIGNED_DEFAULT(  16), ZYCORE_ALIGNED_DEFAULT(  32),
+        ZYCORE_ALIGNED_DEFAULT(  64), ZYCORE_ALIGNED_DEFAULT( 128), ZYCORE_ALIGNED_DEFAULT( 256),
+        ZYCORE_ALIGNED_DEFAULT( 512), ZYCORE_ALIGNED_DEFAULT(1024), ZYCORE_ALIGNED_DEFAULT(2048),
+        ZYCORE_ALIGNED_DEFAULT(4096)
     };
-    return &allocator;
+
+#   undef ZYCORE_ALIGNED_DEFAULT
+
+    ZYAN_STATIC_ASSERT(
+        (1 << (ZYAN_ARRAY_LENGTH(allocators) - 1)) == ZYAN_ALLOCATOR_MAX_DEFAULT_ALIGNMENT);
+
+    if (!alignment || !ZYAN_IS_POWER_OF_2(alignment) ||
+        (alignment > ZYAN_ALLOCATOR_MAX_DEFAULT_ALIGNMENT))
+    {
+        return ZYAN_NULL;
+    }
+
+    ZyanUSize index = 0;
+    while (((ZyanUSize)1 << index) < alignment)
+    {
+        ++index;
+    }
+
+    return &allocators[index].allocator;
+}
+
+ZyanAllocator* ZyanAllocatorLargePage(void)
+{
+    return &ZyanAllocatorLargePageInstance;
 }
 
 #endif
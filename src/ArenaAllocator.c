@@ -0,0 +1,367 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/ArenaAllocator.h>
+#include <Zycore/LibC.h>
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * The size of the chunk header (in bytes), including padding.
+ */
+#define ZYCORE_ARENA_CHUNK_HEADER_SIZE \
+    ZYAN_ALIGN_UP(sizeof(ZyanArenaChunk), ZYAN_ARENA_ALIGNMENT)
+
+/**
+ * The size of the block header (in bytes), including padding.
+ *
+ * Each block is prefixed with its size, which is required to copy the block contents when a
+ * block can not be grown in place.
+ */
+#define ZYCORE_ARENA_BLOCK_HEADER_SIZE \
+    ZYAN_ALIGN_UP(sizeof(ZyanUSize), ZYAN_ARENA_ALIGNMENT)
+
+/**
+ * Returns a pointer to the usable memory of the given `chunk`.
+ *
+ * @param   chunk   A pointer to the `ZyanArenaChunk` struct.
+ *
+ * @return  A pointer to the usable memory of the given `chunk`.
+ */
+#define ZYCORE_ARENA_CHUNK_DATA(chunk) \
+    ((ZyanU8*)(chunk) + ZYCORE_ARENA_CHUNK_HEADER_SIZE)
+
+/**
+ * Returns a pointer to the size field of the given memory block.
+ *
+ * @param   p   A pointer to the memory block.
+ *
+ * @return  A pointer to the size field of the given memory block.
+ */
+#define ZYCORE_ARENA_BLOCK_SIZE(p) \
+    ((ZyanUSize*)((ZyanU8*)(p) - ZYCORE_ARENA_BLOCK_HEADER_SIZE))
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Makes a chunk with at least `size` free bytes the current chunk.
+ *
+ * @param   arena   A pointer to the `ZyanArenaAllocator` instance.
+ * @param   size    The required number of free bytes.
+ *
+ * @return  A zyan status code.
+ *
+ * Chunks that were kept by `ZyanArenaReset` are reused, if large enough. Otherwise a new chunk is
+ * obtained from the backing allocator and linked behind the current chunk.
+ */
+static ZyanStatus ZyanArenaNextChunk(ZyanArenaAllocator* arena, ZyanUSize size)
+{
+    ZYAN_ASSERT(arena);
+
+    ZyanArenaChunk* const next = arena->current ? arena->current->next : arena->head;
+    if (next && (next->capacity >= size))
+    {
+        arena->current = next;
+        arena->offset  = 0;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    if (!arena->backing)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    ZYAN_ASSERT(arena->backing->allocate);
+
+    const ZyanUSize capacity = ZYAN_ALIGN_UP(ZYAN_MAX(size, arena->chunk_size),
+        ZYAN_ARENA_ALIGNMENT);
+    ZyanArenaChunk* chunk;
+    ZYAN_CHECK(arena->backing->allocate(arena->backing, (void**)&chunk, sizeof(ZyanU8),
+        ZYCORE_ARENA_CHUNK_HEADER_SIZE + capacity));
+
+    chunk->next     = next;
+    chunk->capacity = capacity;
+    if (arena->current)
+    {
+        arena->current->next = chunk;
+    } else
+    {
+        arena->head = chunk;
+    }
+
+    arena->current = chunk;
+    arena->offset  = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Carves a new memory block out of the current chunk.
+ *
+ * @param   arena   A pointer to the `ZyanArenaAllocator` instance.
+ * @param   p       Receives a pointer to the new memory block.
+ * @param   size    The size of the memory block (in bytes).
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanArenaAllocateBlock(ZyanArenaAllocator* arena, void** p, ZyanUSize size)
+{
+    ZYAN_ASSERT(arena);
+    ZYAN_ASSERT(p);
+
+    const ZyanUSize required = ZYCORE_ARENA_BLOCK_HEADER_SIZE +
+        ZYAN_ALIGN_UP(size, ZYAN_ARENA_ALIGNMENT);
+    if (!arena->current || (arena->offset + required > arena->current->capacity))
+    {
+        ZYAN_CHECK(ZyanArenaNextChunk(arena, required));
+    }
+
+    ZyanU8* const block = ZYCORE_ARENA_CHUNK_DATA(arena->current) + arena->offset +
+        ZYCORE_ARENA_BLOCK_HEADER_SIZE;
+    *ZYCORE_ARENA_BLOCK_SIZE(block) = size;
+    arena->offset += required;
+    arena->last    = block;
+
+    *p = block;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Allocator callbacks                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+static ZyanStatus ZyanArenaAllocate(ZyanAllocator* allocator, void** p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    return ZyanArenaAllocateBlock((ZyanArenaAllocator*)allocator, p, element_size * n);
+}
+
+static ZyanStatus ZyanArenaExpand(ZyanAllocator* allocator, void* p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanArenaAllocator* const arena = (ZyanArenaAllocator*)allocator;
+    ZyanUSize* const block_size = ZYCORE_ARENA_BLOCK_SIZE(p);
+    const ZyanUSize size = element_size * n;
+
+    if (p == arena->last)
+    {
+        // The most recent block can be resized in place, as long as it fits into the current chunk
+        const ZyanUSize offset = (ZyanUSize)((ZyanU8*)p - ZYCORE_ARENA_CHUNK_DATA(arena->current));
+        const ZyanUSize end = offset + ZYAN_ALIGN_UP(size, ZYAN_ARENA_ALIGNMENT);
+        if (end <= arena->current->capacity)
+        {
+            *block_size   = size;
+            arena->offset = end;
+            return ZYAN_STATUS_TRUE;
+        }
+        return ZYAN_STATUS_FALSE;
+    }
+
+    return (size <= *block_size) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+static ZyanStatus ZyanArenaReallocate(ZyanAllocator* allocator, void** p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(*p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    if (ZyanArenaExpand(allocator, *p, element_size, n) == ZYAN_STATUS_TRUE)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZyanArenaAllocator* const arena = (ZyanArenaAllocator*)allocator;
+    const ZyanUSize* const block_size = ZYCORE_ARENA_BLOCK_SIZE(*p);
+    const ZyanUSize size = element_size * n;
+
+    void* block;
+    ZYAN_CHECK(ZyanArenaAllocateBlock(arena, &block, size));
+    ZYAN_MEMCPY(block, *p, ZYAN_MIN(size, *block_size));
+    *p = block;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanArenaDeallocate(ZyanAllocator* allocator, void* p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(allocator);
+    ZYAN_UNUSED(p);
+    ZYAN_UNUSED(element_size);
+    ZYAN_UNUSED(n);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanArenaInit(ZyanArenaAllocator* arena, ZyanUSize chunk_size)
+{
+    return ZyanArenaInitEx(arena, chunk_size, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanArenaInitEx(ZyanArenaAllocator* arena, ZyanUSize chunk_size,
+    ZyanAllocator* backing)
+{
+    if (!arena || !backing)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanAllocatorInitEx(&arena->allocator, &ZyanArenaAllocate, &ZyanArenaReallocate,
+        &ZyanArenaDeallocate, &ZyanArenaExpand));
+
+    arena->backing    = backing;
+    arena->chunk_size = chunk_size ? chunk_size : ZYAN_ARENA_DEFAULT_CHUNK_SIZE;
+    arena->head       = ZYAN_NULL;
+    arena->current    = ZYAN_NULL;
+    arena->offset     = 0;
+    arena->last       = ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanArenaInitCustomBuffer(ZyanArenaAllocator* arena, void* buffer, ZyanUSize capacity)
+{
+    if (!arena || !buffer)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUPointer address = (ZyanUPointer)buffer;
+    const ZyanUSize padding = (ZyanUSize)(ZYAN_ALIGN_UP(address, ZYAN_ARENA_ALIGNMENT) - address);
+    if (capacity < padding + ZYCORE_ARENA_CHUNK_HEADER_SIZE)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    ZYAN_CHECK(ZyanAllocatorInitEx(&arena->allocator, &ZyanArenaAllocate, &ZyanArenaReallocate,
+        &ZyanArenaDeallocate, &ZyanArenaExpand));
+
+    ZyanArenaChunk* const chunk = (ZyanArenaChunk*)((ZyanU8*)buffer + padding);
+    chunk->next     = ZYAN_NULL;
+    chunk->capacity = capacity - padding - ZYCORE_ARENA_CHUNK_HEADER_SIZE;
+
+    arena->backing    = ZYAN_NULL;
+    arena->chunk_size = chunk->capacity;
+    arena->head       = chunk;
+    arena->current    = ZYAN_NULL;
+    arena->offset     = 0;
+    arena->last       = ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanArenaDestroy(ZyanArenaAllocator* arena)
+{
+    if (!arena)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (arena->backing)
+    {
+        ZYAN_ASSERT(arena->backing->deallocate);
+
+        ZyanArenaChunk* chunk = arena->head;
+        while (chunk)
+        {
+            ZyanArenaChunk* const next = chunk->next;
+            ZYAN_CHECK(arena->backing->deallocate(arena->backing, chunk, sizeof(ZyanU8),
+                ZYCORE_ARENA_CHUNK_HEADER_SIZE + chunk->capacity));
+            chunk = next;
+        }
+    }
+
+    arena->head    = ZYAN_NULL;
+    arena->current = ZYAN_NULL;
+    arena->offset  = 0;
+    arena->last    = ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanArenaReset(ZyanArenaAllocator* arena)
+{
+    if (!arena)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    arena->current = ZYAN_NULL;
+    arena->offset  = 0;
+    arena->last    = ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -24,6 +24,9 @@
 
 ***************************************************************************************************/
 
+// The exported functions in this file must not be replaced by the inline fast paths
+#undef ZYCORE_INLINE_FASTPATH
+
 #include <Zycore/Bitset.h>
 #include <Zycore/LibC.h>
 
@@ -0,0 +1,503 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/Deque.h>
+#include <Zycore/LibC.h>
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Returns the position of the element at the given `index` in the ring buffer.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   index   The element index, counted from the front of the deque.
+ *
+ * @return  The position of the element in the ring buffer.
+ */
+#define ZYCORE_DEQUE_POSITION(deque, index) \
+    (((deque)->head + (index)) & ((deque)->capacity - 1))
+
+/**
+ * Returns a pointer to the given `position` of the ring buffer.
+ *
+ * @param   deque       A pointer to the `ZyanDeque` instance.
+ * @param   position    The position in the ring buffer.
+ *
+ * @return  A pointer to the given position.
+ */
+#define ZYCORE_DEQUE_OFFSET(deque, position) \
+    ((void*)((ZyanU8*)(deque)->data + ((position) * (deque)->element_size)))
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Rounds the given capacity up to the next power of two.
+ *
+ * @param   capacity    The desired capacity.
+ *
+ * @return  The rounded capacity or `0`, if the result does not fit into a `ZyanUSize`.
+ */
+static ZyanUSize ZyanDequeCalculateCapacity(ZyanUSize capacity)
+{
+    ZyanUSize result = ZYAN_DEQUE_MIN_CAPACITY;
+    while (result < capacity)
+    {
+        if (result > ((ZyanUSize)-1 >> 1))
+        {
+            return 0;
+        }
+        result <<= 1;
+    }
+
+    return result;
+}
+
+/**
+ * Copies elements out of the ring buffer.
+ *
+ * @param   deque       A pointer to the `ZyanDeque` instance.
+ * @param   index       The index of the first element, counted from the front of the deque.
+ * @param   destination A pointer to the destination array.
+ * @param   count       The number of elements to copy.
+ */
+static void ZyanDequeCopyOut(const ZyanDeque* deque, ZyanUSize index, void* destination,
+    ZyanUSize count)
+{
+    ZYAN_ASSERT(deque);
+    ZYAN_ASSERT(index + count <= deque->size);
+
+    const ZyanUSize position = ZYCORE_DEQUE_POSITION(deque, index);
+    const ZyanUSize first = ZYAN_MIN(count, deque->capacity - position);
+    ZYAN_MEMCPY(destination, ZYCORE_DEQUE_OFFSET(deque, position), first * deque->element_size);
+    if (count > first)
+    {
+        ZYAN_MEMCPY((ZyanU8*)destination + first * deque->element_size, deque->data,
+            (count - first) * deque->element_size);
+    }
+}
+
+/**
+ * Copies elements into the ring buffer.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   index   The index of the first element, counted from the front of the deque.
+ * @param   source  A pointer to the source array.
+ * @param   count   The number of elements to copy.
+ */
+static void ZyanDequeCopyIn(ZyanDeque* deque, ZyanUSize index, const void* source,
+    ZyanUSize count)
+{
+    ZYAN_ASSERT(deque);
+    ZYAN_ASSERT(index + count <= deque->capacity);
+
+    const ZyanUSize position = ZYCORE_DEQUE_POSITION(deque, index);
+    const ZyanUSize first = ZYAN_MIN(count, deque->capacity - position);
+    ZYAN_MEMCPY(ZYCORE_DEQUE_OFFSET(deque, position), source, first * deque->element_size);
+    if (count > first)
+    {
+        ZYAN_MEMCPY(deque->data, (const ZyanU8*)source + first * deque->element_size,
+            (count - first) * deque->element_size);
+    }
+}
+
+/**
+ * Moves the elements of the deque to a new ring buffer.
+ *
+ * @param   deque       A pointer to the `ZyanDeque` instance.
+ * @param   capacity    The new capacity. Must be a power of two not less than the size.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanDequeReallocate(ZyanDeque* deque, ZyanUSize capacity)
+{
+    ZYAN_ASSERT(deque);
+    ZYAN_ASSERT(deque->allocator);
+    ZYAN_ASSERT(deque->allocator->allocate);
+    ZYAN_ASSERT(deque->allocator->deallocate);
+    ZYAN_ASSERT(capacity >= deque->size);
+    ZYAN_ASSERT(!(capacity & (capacity - 1)));
+
+    void* data;
+    ZYAN_CHECK(deque->allocator->allocate(deque->allocator, &data, deque->element_size,
+        capacity));
+    ZyanDequeCopyOut(deque, 0, data, deque->size);
+
+    void* const previous_data = deque->data;
+    const ZyanUSize previous_capacity = deque->capacity;
+    deque->data     = data;
+    deque->capacity = capacity;
+    deque->head     = 0;
+
+    return deque->allocator->deallocate(deque->allocator, previous_data, deque->element_size,
+        previous_capacity);
+}
+
+/**
+ * Grows the ring buffer, if it can not hold the given number of elements.
+ *
+ * @param   deque   A pointer to the `ZyanDeque` instance.
+ * @param   size    The desired size of the deque.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanDequeGrow(ZyanDeque* deque, ZyanUSize size)
+{
+    ZYAN_ASSERT(deque);
+
+    if (size <= deque->capacity)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    const ZyanUSize capacity = ZyanDequeCalculateCapacity(size);
+    if (!capacity)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    return ZyanDequeReallocate(deque, capacity);
+}
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanDequeInit(ZyanDeque* deque, ZyanUSize element_size, ZyanUSize capacity,
+    ZyanMemberProcedure destructor)
+{
+    return ZyanDequeInitEx(deque, element_size, capacity, destructor, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanDequeInitEx(ZyanDeque* deque, ZyanUSize element_size, ZyanUSize capacity,
+    ZyanMemberProcedure destructor, ZyanAllocator* allocator)
+{
+    if (!deque || !element_size || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(allocator->allocate);
+
+    capacity = ZyanDequeCalculateCapacity(capacity);
+    if (!capacity)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    deque->allocator    = allocator;
+    deque->size         = 0;
+    deque->capacity     = capacity;
+    deque->head         = 0;
+    deque->element_size = element_size;
+    deque->destructor   = destructor;
+    deque->data         = ZYAN_NULL;
+
+    return allocator->allocate(deque->allocator, &deque->data, deque->element_size,
+        deque->capacity);
+}
+
+ZyanStatus ZyanDequeDestroy(ZyanDeque* deque)
+{
+    if (!deque)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(deque->data);
+
+    ZYAN_CHECK(ZyanDequeClear(deque));
+
+    ZYAN_ASSERT(deque->allocator->deallocate);
+    ZYAN_CHECK(deque->allocator->deallocate(deque->allocator, deque->data, deque->element_size,
+        deque->capacity));
+
+    deque->data = ZYAN_NULL;
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Element access                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+const void* ZyanDequeGet(const ZyanDeque* deque, ZyanUSize index)
+{
+    if (!deque || (index >= deque->size))
+    {
+        return ZYAN_NULL;
+    }
+
+    return ZYCORE_DEQUE_OFFSET(deque, ZYCORE_DEQUE_POSITION(deque, index));
+}
+
+void* ZyanDequeGetMutable(const ZyanDeque* deque, ZyanUSize index)
+{
+    if (!deque || (index >= deque->size))
+    {
+        return ZYAN_NULL;
+    }
+
+    return ZYCORE_DEQUE_OFFSET(deque, ZYCORE_DEQUE_POSITION(deque, index));
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanDequePushBack(ZyanDeque* deque, const void* element)
+{
+    if (!deque || !element)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanDequeGrow(deque, deque->size + 1));
+
+    ZYAN_MEMCPY(ZYCORE_DEQUE_OFFSET(deque, ZYCORE_DEQUE_POSITION(deque, deque->size)), element,
+        deque->element_size);
+    ++deque->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanDequePushFront(ZyanDeque* deque, const void* element)
+{
+    if (!deque || !element)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanDequeGrow(deque, deque->size + 1));
+
+    deque->head = (deque->head - 1) & (deque->capacity - 1);
+    ZYAN_MEMCPY(ZYCORE_DEQUE_OFFSET(deque, deque->head), element, deque->element_size);
+    ++deque->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanDequePushBackRange(ZyanDeque* deque, const void* elements, ZyanUSize count)
+{
+    if (!deque || !elements || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (count > (ZyanUSize)-1 - deque->size)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+    ZYAN_CHECK(ZyanDequeGrow(deque, deque->size + count));
+
+    ZyanDequeCopyIn(deque, deque->size, elements, count);
+    deque->size += count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanDequePopBack(ZyanDeque* deque, void* element)
+{
+    if (!deque)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (deque->size == 0)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    void* const offset = ZYCORE_DEQUE_OFFSET(deque, ZYCORE_DEQUE_POSITION(deque, deque->size - 1));
+    if (element)
+    {
+        ZYAN_MEMCPY(element, offset, deque->element_size);
+    } else
+    if (deque->destructor)
+    {
+        deque->destructor(offset);
+    }
+
+    --deque->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanDequePopFront(ZyanDeque* deque, void* element)
+{
+    if (!deque)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (deque->size == 0)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    void* const offset = ZYCORE_DEQUE_OFFSET(deque, deque->head);
+    if (element)
+    {
+        ZYAN_MEMCPY(element, offset, deque->element_size);
+    } else
+    if (deque->destructor)
+    {
+        deque->destructor(offset);
+    }
+
+    deque->head = (deque->head + 1) & (deque->capacity - 1);
+    --deque->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanDequePopFrontRange(ZyanDeque* deque, void* elements, ZyanUSize count)
+{
+    if (!deque || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (count > deque->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    if (elements)
+    {
+        ZyanDequeCopyOut(deque, 0, elements, count);
+    } else
+    if (deque->destructor)
+    {
+        for (ZyanUSize i = 0; i < count; ++i)
+        {
+            deque->destructor(ZYCORE_DEQUE_OFFSET(deque, ZYCORE_DEQUE_POSITION(deque, i)));
+        }
+    }
+
+    deque->head = (deque->head + count) & (deque->capacity - 1);
+    deque->size -= count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanDequeClear(ZyanDeque* deque)
+{
+    if (!deque)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (deque->destructor)
+    {
+        for (ZyanUSize i = 0; i < deque->size; ++i)
+        {
+            deque->destructor(ZYCORE_DEQUE_OFFSET(deque, ZYCORE_DEQUE_POSITION(deque, i)));
+        }
+    }
+
+    deque->size = 0;
+    deque->head = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanDequeReserve(ZyanDeque* deque, ZyanUSize capacity)
+{
+    if (!deque)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanDequeGrow(deque, capacity);
+}
+
+ZyanStatus ZyanDequeShrinkToFit(ZyanDeque* deque)
+{
+    if (!deque)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize capacity = ZyanDequeCalculateCapacity(deque->size);
+    if (capacity < deque->capacity)
+    {
+        return ZyanDequeReallocate(deque, capacity);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanDequeGetCapacity(const ZyanDeque* deque, ZyanUSize* capacity)
+{
+    if (!deque || !capacity)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *capacity = deque->capacity;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanDequeGetSize(const ZyanDeque* deque, ZyanUSize* size)
+{
+    if (!deque || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = deque->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
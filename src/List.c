@@ -67,7 +67,7 @@ static ZyanStatus ZyanListAllocateNode(ZyanList* list, ZyanListNode** node)
     {
         ZYAN_ASSERT(list->allocator->allocate);
         ZYAN_CHECK(list->allocator->allocate(list->allocator, (void**)node,
-            sizeof(ZyanListNode) + list->element_size, 1));
+            ZYAN_LIST_NODE_SIZE(list->element_size), 1));
     } else
     {
         if (list->first_unused)
@@ -107,7 +107,7 @@ static ZyanStatus ZyanListDeallocateNode(ZyanList* list, ZyanListNode* node)
     {
         ZYAN_ASSERT(list->allocator->deallocate);
         ZYAN_CHECK(list->allocator->deallocate(list->allocator, (void*)node,
-            sizeof(ZyanListNode) + list->element_size, 1));
+            ZYAN_LIST_NODE_SIZE(list->element_size), 1));
     } else
     {
         node->next = list->first_unused;
@@ -158,6 +158,17 @@ ZyanStatus ZyanListInitEx(ZyanList* list, ZyanUSize element_size, ZyanMemberProc
     return ZYAN_STATUS_SUCCESS;
 }
 
+ZyanStatus ZyanListInitPooled(ZyanList* list, ZyanUSize element_size,
+    ZyanMemberProcedure destructor, ZyanPoolAllocator* pool)
+{
+    if (!pool || (pool->block_size < ZYAN_LIST_NODE_SIZE(element_size)))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanListInitEx(list, element_size, destructor, &pool->allocator);
+}
+
 ZyanStatus ZyanListInitCustomBuffer(ZyanList* list, ZyanUSize element_size,
     ZyanMemberProcedure destructor, void* buffer, ZyanUSize capacity)
 {
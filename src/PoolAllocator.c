@@ -0,0 +1,311 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/LibC.h>
+#include <Zycore/PoolAllocator.h>
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * The size of the slab header (in bytes), including padding.
+ */
+#define ZYCORE_POOL_SLAB_HEADER_SIZE \
+    ZYAN_ALIGN_UP(sizeof(ZyanPoolSlab), ZYAN_POOL_ALIGNMENT)
+
+/**
+ * Returns a pointer to the first block of the given `slab`.
+ *
+ * @param   slab    A pointer to the `ZyanPoolSlab` struct.
+ *
+ * @return  A pointer to the first block of the given `slab`.
+ */
+#define ZYCORE_POOL_SLAB_DATA(slab) \
+    ((ZyanU8*)(slab) + ZYCORE_POOL_SLAB_HEADER_SIZE)
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Obtains a new slab from the backing allocator.
+ *
+ * @param   pool    A pointer to the `ZyanPoolAllocator` instance.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanPoolAllocateSlab(ZyanPoolAllocator* pool)
+{
+    ZYAN_ASSERT(pool);
+
+    if (!pool->backing)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    ZYAN_ASSERT(pool->backing->allocate);
+
+    ZyanPoolSlab* slab;
+    ZYAN_CHECK(pool->backing->allocate(pool->backing, (void**)&slab, sizeof(ZyanU8),
+        ZYCORE_POOL_SLAB_HEADER_SIZE + pool->block_size * pool->blocks_per_slab));
+
+    slab->next         = pool->slabs;
+    pool->slabs        = slab;
+    pool->unused       = ZYCORE_POOL_SLAB_DATA(slab);
+    pool->unused_count = pool->blocks_per_slab;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Allocator callbacks                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+static ZyanStatus ZyanPoolAllocate(ZyanAllocator* allocator, void** p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanPoolAllocator* const pool = (ZyanPoolAllocator*)allocator;
+    if (element_size * n > pool->block_size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (pool->free_list)
+    {
+        *p = pool->free_list;
+        pool->free_list = *(void**)pool->free_list;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    if (!pool->unused_count)
+    {
+        ZYAN_CHECK(ZyanPoolAllocateSlab(pool));
+    }
+
+    *p = pool->unused;
+    pool->unused += pool->block_size;
+    --pool->unused_count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanPoolReallocate(ZyanAllocator* allocator, void** p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    // All blocks share the same size, so any request that fits is satisfied in place
+    const ZyanPoolAllocator* const pool = (const ZyanPoolAllocator*)allocator;
+    if (element_size * n > pool->block_size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanPoolExpand(ZyanAllocator* allocator, void* p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(p);
+
+    const ZyanPoolAllocator* const pool = (const ZyanPoolAllocator*)allocator;
+    return (element_size * n <= pool->block_size) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+static ZyanStatus ZyanPoolDeallocate(ZyanAllocator* allocator, void* p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(element_size);
+    ZYAN_UNUSED(n);
+
+    ZyanPoolAllocator* const pool = (ZyanPoolAllocator*)allocator;
+    *(void**)p = pool->free_list;
+    pool->free_list = p;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Initialization                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Initializes the common fields of the given `ZyanPoolAllocator` instance.
+ *
+ * @param   pool        A pointer to the `ZyanPoolAllocator` instance.
+ * @param   block_size  The size of a single block (in bytes).
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanPoolInitBase(ZyanPoolAllocator* pool, ZyanUSize block_size)
+{
+    ZYAN_ASSERT(pool);
+    ZYAN_ASSERT(block_size);
+
+    ZYAN_CHECK(ZyanAllocatorInitEx(&pool->allocator, &ZyanPoolAllocate, &ZyanPoolReallocate,
+        &ZyanPoolDeallocate, &ZyanPoolExpand));
+
+    pool->block_size   = ZYAN_ALIGN_UP(ZYAN_MAX(block_size, sizeof(void*)), ZYAN_POOL_ALIGNMENT);
+    pool->slabs        = ZYAN_NULL;
+    pool->free_list    = ZYAN_NULL;
+    pool->unused       = ZYAN_NULL;
+    pool->unused_count = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanPoolInit(ZyanPoolAllocator* pool, ZyanUSize block_size, ZyanUSize blocks_per_slab)
+{
+    return ZyanPoolInitEx(pool, block_size, blocks_per_slab, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanPoolInitEx(ZyanPoolAllocator* pool, ZyanUSize block_size,
+    ZyanUSize blocks_per_slab, ZyanAllocator* backing)
+{
+    if (!pool || !block_size || !backing)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanPoolInitBase(pool, block_size));
+
+    pool->backing         = backing;
+    pool->blocks_per_slab = blocks_per_slab ? blocks_per_slab : ZYAN_POOL_DEFAULT_BLOCKS_PER_SLAB;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanPoolInitCustomBuffer(ZyanPoolAllocator* pool, ZyanUSize block_size, void* buffer,
+    ZyanUSize capacity)
+{
+    if (!pool || !block_size || !buffer)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanPoolInitBase(pool, block_size));
+
+    const ZyanUPointer address = (ZyanUPointer)buffer;
+    const ZyanUSize padding = (ZyanUSize)(ZYAN_ALIGN_UP(address, ZYAN_POOL_ALIGNMENT) - address);
+    if (capacity < padding + pool->block_size)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    pool->backing         = ZYAN_NULL;
+    pool->blocks_per_slab = (capacity - padding) / pool->block_size;
+    pool->unused          = (ZyanU8*)buffer + padding;
+    pool->unused_count    = pool->blocks_per_slab;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanPoolDestroy(ZyanPoolAllocator* pool)
+{
+    if (!pool)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (pool->backing)
+    {
+        ZYAN_ASSERT(pool->backing->deallocate);
+
+        ZyanPoolSlab* slab = pool->slabs;
+        while (slab)
+        {
+            ZyanPoolSlab* const next = slab->next;
+            ZYAN_CHECK(pool->backing->deallocate(pool->backing, slab, sizeof(ZyanU8),
+                ZYCORE_POOL_SLAB_HEADER_SIZE + pool->block_size * pool->blocks_per_slab));
+            slab = next;
+        }
+    }
+
+    pool->slabs        = ZYAN_NULL;
+    pool->free_list    = ZYAN_NULL;
+    pool->unused       = ZYAN_NULL;
+    pool->unused_count = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanPoolGetBlockSize(const ZyanPoolAllocator* pool, ZyanUSize* block_size)
+{
+    if (!pool || !block_size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *block_size = pool->block_size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,434 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/LibC.h>
+#include <Zycore/SegmentedVector.h>
+#include <Zycore/Internal/BitScan.h>
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Returns the capacity (number of elements) of the block at the given `block` index.
+ *
+ * @param   vector  A pointer to the `ZyanSegmentedVector` instance.
+ * @param   block   The block index.
+ *
+ * @return  The capacity of the block.
+ */
+#define ZYCORE_SEGMENTED_VECTOR_BLOCK_CAPACITY(vector, block) \
+    ((ZyanUSize)1 << ((vector)->block_shift + (block)))
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns a pointer to the element at the given `index`.
+ *
+ * @param   vector  A pointer to the `ZyanSegmentedVector` instance.
+ * @param   index   The element index. Must be less than the capacity of the vector.
+ *
+ * @return  A pointer to the element.
+ *
+ * Block `k` holds `2^k` times the capacity of the first block and starts at element index
+ * `(2^k - 1) * first_block_capacity`.
+ */
+static void* ZyanSegmentedVectorOffset(const ZyanSegmentedVector* vector, ZyanUSize index)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(index < vector->capacity);
+
+    const ZyanU32 block = ZyanBitScanReverse((index >> vector->block_shift) + 1);
+    const ZyanUSize first = (((ZyanUSize)1 << block) - 1) << vector->block_shift;
+
+    ZYAN_ASSERT(block < vector->block_count);
+    return (ZyanU8*)vector->blocks[block] + (index - first) * vector->element_size;
+}
+
+/**
+ * Allocates blocks until the vector has at least the given capacity.
+ *
+ * @param   vector      A pointer to the `ZyanSegmentedVector` instance.
+ * @param   capacity    The desired capacity.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanSegmentedVectorGrow(ZyanSegmentedVector* vector, ZyanUSize capacity)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(vector->allocator);
+    ZYAN_ASSERT(vector->allocator->allocate);
+
+    while (vector->capacity < capacity)
+    {
+        const ZyanU8 block = vector->block_count;
+        if ((block >= ZYAN_SEGMENTED_VECTOR_MAX_BLOCKS) ||
+            (vector->block_shift + block >= sizeof(ZyanUSize) * 8 - 1))
+        {
+            return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+        }
+
+        const ZyanUSize count = ZYCORE_SEGMENTED_VECTOR_BLOCK_CAPACITY(vector, block);
+        if (count > (ZyanUSize)-1 / vector->element_size)
+        {
+            return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+        }
+
+        ZYAN_CHECK(vector->allocator->allocate(vector->allocator, &vector->blocks[block],
+            vector->element_size, count));
+        vector->capacity += count;
+        ++vector->block_count;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanSegmentedVectorInit(ZyanSegmentedVector* vector, ZyanUSize element_size,
+    ZyanUSize block_capacity, ZyanMemberProcedure destructor)
+{
+    return ZyanSegmentedVectorInitEx(vector, element_size, block_capacity, destructor,
+        ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanSegmentedVectorInitEx(ZyanSegmentedVector* vector, ZyanUSize element_size,
+    ZyanUSize block_capacity, ZyanMemberProcedure destructor, ZyanAllocator* allocator)
+{
+    if (!vector || !element_size || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (!block_capacity)
+    {
+        block_capacity = ZYAN_SEGMENTED_VECTOR_DEFAULT_BLOCK_CAPACITY;
+    }
+    ZyanU32 block_shift = ZyanBitScanReverse(block_capacity);
+    if (block_capacity & (block_capacity - 1))
+    {
+        ++block_shift;
+    }
+    if (block_shift >= sizeof(ZyanUSize) * 8 - 1)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    vector->allocator    = allocator;
+    vector->size         = 0;
+    vector->capacity     = 0;
+    vector->element_size = element_size;
+    vector->block_shift  = (ZyanU8)block_shift;
+    vector->block_count  = 0;
+    vector->destructor   = destructor;
+    ZYAN_MEMSET(vector->blocks, 0, sizeof(vector->blocks));
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSegmentedVectorDestroy(ZyanSegmentedVector* vector)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanSegmentedVectorClear(vector));
+    return ZyanSegmentedVectorShrinkToFit(vector);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Element access                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+const void* ZyanSegmentedVectorGet(const ZyanSegmentedVector* vector, ZyanUSize index)
+{
+    if (!vector || (index >= vector->size))
+    {
+        return ZYAN_NULL;
+    }
+
+    return ZyanSegmentedVectorOffset(vector, index);
+}
+
+void* ZyanSegmentedVectorGetMutable(const ZyanSegmentedVector* vector, ZyanUSize index)
+{
+    if (!vector || (index >= vector->size))
+    {
+        return ZYAN_NULL;
+    }
+
+    return ZyanSegmentedVectorOffset(vector, index);
+}
+
+ZyanStatus ZyanSegmentedVectorGetPointer(const ZyanSegmentedVector* vector, ZyanUSize index,
+    const void** value)
+{
+    if (!vector || !value)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= vector->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    *value = (const void*)ZyanSegmentedVectorOffset(vector, index);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSegmentedVectorGetPointerMutable(const ZyanSegmentedVector* vector,
+    ZyanUSize index, void** value)
+{
+    if (!vector || !value)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= vector->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    *value = ZyanSegmentedVectorOffset(vector, index);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSegmentedVectorSet(ZyanSegmentedVector* vector, ZyanUSize index,
+    const void* value)
+{
+    if (!vector || !value)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= vector->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    void* const offset = ZyanSegmentedVectorOffset(vector, index);
+    if (vector->destructor)
+    {
+        vector->destructor(offset);
+    }
+    ZYAN_MEMCPY(offset, value, vector->element_size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSegmentedVectorPushBack(ZyanSegmentedVector* vector, const void* element)
+{
+    if (!vector || !element)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    void* offset;
+    ZYAN_CHECK(ZyanSegmentedVectorEmplace(vector, &offset));
+    ZYAN_MEMCPY(offset, element, vector->element_size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSegmentedVectorEmplace(ZyanSegmentedVector* vector, void** element)
+{
+    if (!vector || !element)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (vector->size == vector->capacity)
+    {
+        ZYAN_CHECK(ZyanSegmentedVectorGrow(vector, vector->size + 1));
+    }
+
+    *element = ZyanSegmentedVectorOffset(vector, vector->size);
+    ++vector->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSegmentedVectorPopBack(ZyanSegmentedVector* vector)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (vector->size == 0)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    --vector->size;
+    if (vector->destructor)
+    {
+        vector->destructor(ZyanSegmentedVectorOffset(vector, vector->size));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSegmentedVectorClear(ZyanSegmentedVector* vector)
+{
+    return ZyanSegmentedVectorResizeEx(vector, 0, ZYAN_NULL);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSegmentedVectorResize(ZyanSegmentedVector* vector, ZyanUSize size)
+{
+    return ZyanSegmentedVectorResizeEx(vector, size, ZYAN_NULL);
+}
+
+ZyanStatus ZyanSegmentedVectorResizeEx(ZyanSegmentedVector* vector, ZyanUSize size,
+    const void* initializer)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (vector->destructor && (size < vector->size))
+    {
+        for (ZyanUSize i = size; i < vector->size; ++i)
+        {
+            vector->destructor(ZyanSegmentedVectorOffset(vector, i));
+        }
+    }
+
+    if (size > vector->capacity)
+    {
+        ZYAN_CHECK(ZyanSegmentedVectorGrow(vector, size));
+    }
+
+    if (initializer && (size > vector->size))
+    {
+        for (ZyanUSize i = vector->size; i < size; ++i)
+        {
+            ZYAN_MEMCPY(ZyanSegmentedVectorOffset(vector, i), initializer, vector->element_size);
+        }
+    }
+
+    vector->size = size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSegmentedVectorReserve(ZyanSegmentedVector* vector, ZyanUSize capacity)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanSegmentedVectorGrow(vector, capacity);
+}
+
+ZyanStatus ZyanSegmentedVectorShrinkToFit(ZyanSegmentedVector* vector)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    while (vector->block_count)
+    {
+        const ZyanU8 block = vector->block_count - 1;
+        const ZyanUSize count = ZYCORE_SEGMENTED_VECTOR_BLOCK_CAPACITY(vector, block);
+        if (vector->capacity - count < vector->size)
+        {
+            break;
+        }
+
+        ZYAN_ASSERT(vector->allocator->deallocate);
+        ZYAN_CHECK(vector->allocator->deallocate(vector->allocator, vector->blocks[block],
+            vector->element_size, count));
+        vector->blocks[block] = ZYAN_NULL;
+        vector->capacity -= count;
+        --vector->block_count;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSegmentedVectorGetCapacity(const ZyanSegmentedVector* vector, ZyanUSize* capacity)
+{
+    if (!vector || !capacity)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *capacity = vector->capacity;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSegmentedVectorGetSize(const ZyanSegmentedVector* vector, ZyanUSize* size)
+{
+    if (!vector || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = vector->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,491 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/LibC.h>
+#include <Zycore/SoAVector.h>
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Returns a pointer to the given `field` of the record at the given `index`.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   index   The record index.
+ * @param   field   The field index.
+ *
+ * @return  A pointer to the field.
+ */
+#define ZYCORE_SOA_VECTOR_OFFSET(vector, index, field) \
+    ((void*)((ZyanU8*)(vector)->columns[field] + ((index) * (vector)->field_sizes[field])))
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Calculates the column offsets and the buffer size for the given capacity.
+ *
+ * @param   vector      A pointer to the `ZyanSoAVector` instance.
+ * @param   capacity    The capacity (number of records).
+ * @param   offsets     Receives the offset of each column in bytes.
+ * @param   size        Receives the size of the buffer in bytes.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanSoAVectorCalculateLayout(const ZyanSoAVector* vector, ZyanUSize capacity,
+    ZyanUSize* offsets, ZyanUSize* size)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(offsets);
+    ZYAN_ASSERT(size);
+
+    const ZyanUSize max_size = (ZyanUSize)-1;
+    ZyanUSize offset = 0;
+    for (ZyanUSize i = 0; i < vector->field_count; ++i)
+    {
+        if (offset > max_size - (ZYAN_SOA_VECTOR_COLUMN_ALIGNMENT - 1))
+        {
+            return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+        }
+        offset = ZYAN_ALIGN_UP(offset, (ZyanUSize)ZYAN_SOA_VECTOR_COLUMN_ALIGNMENT);
+        offsets[i] = offset;
+
+        if (capacity > (max_size - offset) / vector->field_sizes[i])
+        {
+            return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+        }
+        offset += capacity * vector->field_sizes[i];
+    }
+
+    *size = offset;
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Moves the columns of the vector to a new buffer.
+ *
+ * @param   vector      A pointer to the `ZyanSoAVector` instance.
+ * @param   capacity    The new capacity. Must not be less than the size.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanSoAVectorReallocate(ZyanSoAVector* vector, ZyanUSize capacity)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(vector->allocator);
+    ZYAN_ASSERT(vector->allocator->allocate);
+    ZYAN_ASSERT(capacity >= vector->size);
+
+    ZyanUSize offsets[ZYAN_SOA_VECTOR_MAX_FIELDS];
+    ZyanUSize data_size;
+    ZYAN_CHECK(ZyanSoAVectorCalculateLayout(vector, capacity, offsets, &data_size));
+
+    void* data;
+    ZYAN_CHECK(vector->allocator->allocate(vector->allocator, &data, 1, data_size));
+
+    for (ZyanUSize i = 0; i < vector->field_count; ++i)
+    {
+        void* const column = (ZyanU8*)data + offsets[i];
+        if (vector->size)
+        {
+            ZYAN_MEMCPY(column, vector->columns[i], vector->size * vector->field_sizes[i]);
+        }
+        vector->columns[i] = column;
+    }
+
+    void* const previous_data = vector->data;
+    const ZyanUSize previous_data_size = vector->data_size;
+    vector->data      = data;
+    vector->data_size = data_size;
+    vector->capacity  = capacity;
+
+    if (!previous_data)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZYAN_ASSERT(vector->allocator->deallocate);
+    return vector->allocator->deallocate(vector->allocator, previous_data, 1, previous_data_size);
+}
+
+/**
+ * Grows the vector, if it can not hold the given number of records.
+ *
+ * @param   vector  A pointer to the `ZyanSoAVector` instance.
+ * @param   size    The desired size of the vector.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanSoAVectorGrow(ZyanSoAVector* vector, ZyanUSize size)
+{
+    ZYAN_ASSERT(vector);
+
+    if (size <= vector->capacity)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+    if (size > (ZyanUSize)-1 / vector->growth_factor)
+    {
+        return ZyanSoAVectorReallocate(vector, size);
+    }
+
+    return ZyanSoAVectorReallocate(vector, size * vector->growth_factor);
+}
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanSoAVectorInit(ZyanSoAVector* vector, const ZyanUSize* field_sizes,
+    ZyanUSize field_count, ZyanUSize capacity)
+{
+    return ZyanSoAVectorInitEx(vector, field_sizes, field_count, capacity,
+        ZyanAllocatorDefaultAligned(ZYAN_SOA_VECTOR_COLUMN_ALIGNMENT),
+        ZYAN_SOA_VECTOR_DEFAULT_GROWTH_FACTOR);
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanSoAVectorInitEx(ZyanSoAVector* vector, const ZyanUSize* field_sizes,
+    ZyanUSize field_count, ZyanUSize capacity, ZyanAllocator* allocator, ZyanU8 growth_factor)
+{
+    if (!vector || !field_sizes || !field_count || (field_count > ZYAN_SOA_VECTOR_MAX_FIELDS) ||
+        !allocator || (growth_factor < 1))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    vector->allocator     = allocator;
+    vector->growth_factor = growth_factor;
+    vector->size          = 0;
+    vector->capacity      = 0;
+    vector->field_count   = field_count;
+    vector->data          = ZYAN_NULL;
+    vector->data_size     = 0;
+    for (ZyanUSize i = 0; i < ZYAN_SOA_VECTOR_MAX_FIELDS; ++i)
+    {
+        if ((i < field_count) && !field_sizes[i])
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+        vector->field_sizes[i] = (i < field_count) ? field_sizes[i] : 0;
+        vector->columns[i]     = ZYAN_NULL;
+    }
+
+    return ZyanSoAVectorReallocate(vector, ZYAN_MAX(1, capacity));
+}
+
+ZyanStatus ZyanSoAVectorDestroy(ZyanSoAVector* vector)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(vector->data);
+    ZYAN_ASSERT(vector->allocator->deallocate);
+
+    ZYAN_CHECK(vector->allocator->deallocate(vector->allocator, vector->data, 1,
+        vector->data_size));
+
+    vector->data = ZYAN_NULL;
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Element access                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+const void* ZyanSoAVectorGetColumn(const ZyanSoAVector* vector, ZyanUSize field)
+{
+    if (!vector || (field >= vector->field_count))
+    {
+        return ZYAN_NULL;
+    }
+
+    return vector->columns[field];
+}
+
+void* ZyanSoAVectorGetColumnMutable(const ZyanSoAVector* vector, ZyanUSize field)
+{
+    if (!vector || (field >= vector->field_count))
+    {
+        return ZYAN_NULL;
+    }
+
+    return vector->columns[field];
+}
+
+const void* ZyanSoAVectorGet(const ZyanSoAVector* vector, ZyanUSize index, ZyanUSize field)
+{
+    if (!vector || (index >= vector->size) || (field >= vector->field_count))
+    {
+        return ZYAN_NULL;
+    }
+
+    return ZYCORE_SOA_VECTOR_OFFSET(vector, index, field);
+}
+
+void* ZyanSoAVectorGetMutable(const ZyanSoAVector* vector, ZyanUSize index, ZyanUSize field)
+{
+    if (!vector || (index >= vector->size) || (field >= vector->field_count))
+    {
+        return ZYAN_NULL;
+    }
+
+    return ZYCORE_SOA_VECTOR_OFFSET(vector, index, field);
+}
+
+ZyanStatus ZyanSoAVectorGetRecord(const ZyanSoAVector* vector, ZyanUSize index,
+    void* const* fields)
+{
+    if (!vector || !fields)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= vector->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    for (ZyanUSize i = 0; i < vector->field_count; ++i)
+    {
+        if (fields[i])
+        {
+            ZYAN_MEMCPY(fields[i], ZYCORE_SOA_VECTOR_OFFSET(vector, index, i),
+                vector->field_sizes[i]);
+        }
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSoAVectorSet(ZyanSoAVector* vector, ZyanUSize index, const void* const* fields)
+{
+    if (!vector || !fields)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= vector->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    for (ZyanUSize i = 0; i < vector->field_count; ++i)
+    {
+        if (fields[i])
+        {
+            ZYAN_MEMCPY(ZYCORE_SOA_VECTOR_OFFSET(vector, index, i), fields[i],
+                vector->field_sizes[i]);
+        }
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSoAVectorPushBack(ZyanSoAVector* vector, const void* const* fields)
+{
+    if (!vector || !fields)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanSoAVectorGrow(vector, vector->size + 1));
+
+    for (ZyanUSize i = 0; i < vector->field_count; ++i)
+    {
+        void* const offset = ZYCORE_SOA_VECTOR_OFFSET(vector, vector->size, i);
+        if (fields[i])
+        {
+            ZYAN_MEMCPY(offset, fields[i], vector->field_sizes[i]);
+        } else
+        {
+            ZYAN_MEMSET(offset, 0, vector->field_sizes[i]);
+        }
+    }
+    ++vector->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSoAVectorEmplace(ZyanSoAVector* vector, void** fields)
+{
+    if (!vector || !fields)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanSoAVectorGrow(vector, vector->size + 1));
+
+    for (ZyanUSize i = 0; i < vector->field_count; ++i)
+    {
+        fields[i] = ZYCORE_SOA_VECTOR_OFFSET(vector, vector->size, i);
+    }
+    ++vector->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSoAVectorPopBack(ZyanSoAVector* vector)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (vector->size == 0)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    --vector->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSoAVectorClear(ZyanSoAVector* vector)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    vector->size = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSoAVectorResize(ZyanSoAVector* vector, ZyanUSize size)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (size > vector->capacity)
+    {
+        ZYAN_CHECK(ZyanSoAVectorReallocate(vector, size));
+    }
+
+    if (size > vector->size)
+    {
+        for (ZyanUSize i = 0; i < vector->field_count; ++i)
+        {
+            ZYAN_MEMSET(ZYCORE_SOA_VECTOR_OFFSET(vector, vector->size, i), 0,
+                (size - vector->size) * vector->field_sizes[i]);
+        }
+    }
+
+    vector->size = size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSoAVectorReserve(ZyanSoAVector* vector, ZyanUSize capacity)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (capacity > vector->capacity)
+    {
+        ZYAN_CHECK(ZyanSoAVectorReallocate(vector, capacity));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSoAVectorShrinkToFit(ZyanSoAVector* vector)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize capacity = ZYAN_MAX(1, vector->size);
+    if (capacity < vector->capacity)
+    {
+        return ZyanSoAVectorReallocate(vector, capacity);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanSoAVectorGetCapacity(const ZyanSoAVector* vector, ZyanUSize* capacity)
+{
+    if (!vector || !capacity)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *capacity = vector->capacity;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanSoAVectorGetSize(const ZyanSoAVector* vector, ZyanUSize* size)
+{
+    if (!vector || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = vector->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
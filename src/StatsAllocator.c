@@ -0,0 +1,361 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/LibC.h>
+#include <Zycore/StatsAllocator.h>
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * The size of the block header (in bytes), including padding.
+ */
+#define ZYCORE_STATS_HEADER_SIZE \
+    ZYAN_ALIGN_UP(sizeof(ZyanUSize), ZYAN_STATS_ALIGNMENT)
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Atomically reads the given counter.
+ *
+ * @param   counter A pointer to the counter.
+ *
+ * @return  The value of the counter.
+ */
+static ZyanU64 ZyanStatsLoad(ZyanAtomic64* counter)
+{
+    ZYAN_ASSERT(counter);
+
+    return ZYAN_ATOMIC_COMPARE_EXCHANGE64(*counter, 0, 0);
+}
+
+/**
+ * Atomically replaces the value of the given counter.
+ *
+ * @param   counter A pointer to the counter.
+ * @param   value   The new value.
+ */
+static void ZyanStatsStore(ZyanAtomic64* counter, ZyanU64 value)
+{
+    ZYAN_ASSERT(counter);
+
+    ZyanU64 current = counter->value;
+    for (;;)
+    {
+        const ZyanU64 previous = ZYAN_ATOMIC_COMPARE_EXCHANGE64(*counter, current, value);
+        if (previous == current)
+        {
+            break;
+        }
+        current = previous;
+    }
+}
+
+/**
+ * Atomically adds `value` to the given counter.
+ *
+ * @param   counter A pointer to the counter.
+ * @param   value   The value to add. Negative values are passed in two's complement.
+ *
+ * @return  The new value of the counter.
+ */
+static ZyanU64 ZyanStatsAdd(ZyanAtomic64* counter, ZyanU64 value)
+{
+    ZYAN_ASSERT(counter);
+
+    ZyanU64 current = counter->value;
+    for (;;)
+    {
+        const ZyanU64 previous = ZYAN_ATOMIC_COMPARE_EXCHANGE64(*counter, current, current + value);
+        if (previous == current)
+        {
+            return current + value;
+        }
+        current = previous;
+    }
+}
+
+/**
+ * Atomically raises the given counter to `value`, if it is currently smaller.
+ *
+ * @param   counter A pointer to the counter.
+ * @param   value   The new candidate value.
+ */
+static void ZyanStatsMax(ZyanAtomic64* counter, ZyanU64 value)
+{
+    ZYAN_ASSERT(counter);
+
+    ZyanU64 current = counter->value;
+    while (current < value)
+    {
+        const ZyanU64 previous = ZYAN_ATOMIC_COMPARE_EXCHANGE64(*counter, current, value);
+        if (previous == current)
+        {
+            break;
+        }
+        current = previous;
+    }
+}
+
+/**
+ * Records a change of the number of live bytes.
+ *
+ * @param   stats       A pointer to the `ZyanStatsAllocator` instance.
+ * @param   old_size    The previous size of the memory block (in bytes).
+ * @param   new_size    The new size of the memory block (in bytes).
+ */
+static void ZyanStatsRecordResize(ZyanStatsAllocator* stats, ZyanUSize old_size,
+    ZyanUSize new_size)
+{
+    ZYAN_ASSERT(stats);
+
+    if (new_size >= old_size)
+    {
+        const ZyanU64 live = ZyanStatsAdd(&stats->live_bytes, (ZyanU64)(new_size - old_size));
+        ZyanStatsMax(&stats->peak_bytes, live);
+    } else
+    {
+        ZyanStatsAdd(&stats->live_bytes, (ZyanU64)0 - (ZyanU64)(old_size - new_size));
+    }
+
+    ZyanUSize bucket = 0;
+    while ((bucket < ZYAN_STATS_HISTOGRAM_SIZE - 1) && (((ZyanU64)1 << bucket) < new_size))
+    {
+        ++bucket;
+    }
+    ZYAN_ATOMIC_INCREMENT64(stats->histogram[bucket]);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Allocator callbacks                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+static ZyanStatus ZyanStatsAllocate(ZyanAllocator* allocator, void** p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanStatsAllocator* const stats = (ZyanStatsAllocator*)allocator;
+    const ZyanUSize size = element_size * n;
+
+    ZyanUSize* header;
+    ZYAN_CHECK(stats->backing->allocate(stats->backing, (void**)&header, sizeof(ZyanU8),
+        ZYCORE_STATS_HEADER_SIZE + size));
+    *header = size;
+    *p = (ZyanU8*)header + ZYCORE_STATS_HEADER_SIZE;
+
+    ZYAN_ATOMIC_INCREMENT64(stats->allocations);
+    ZyanStatsRecordResize(stats, 0, size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanStatsReallocate(ZyanAllocator* allocator, void** p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    if (!*p)
+    {
+        return ZyanStatsAllocate(allocator, p, element_size, n);
+    }
+
+    ZyanStatsAllocator* const stats = (ZyanStatsAllocator*)allocator;
+    const ZyanUSize size = element_size * n;
+
+    ZyanUSize* header = (ZyanUSize*)((ZyanU8*)*p - ZYCORE_STATS_HEADER_SIZE);
+    const ZyanUSize old_size = *header;
+    ZYAN_CHECK(stats->backing->reallocate(stats->backing, (void**)&header, sizeof(ZyanU8),
+        ZYCORE_STATS_HEADER_SIZE + size));
+    *header = size;
+    *p = (ZyanU8*)header + ZYCORE_STATS_HEADER_SIZE;
+
+    ZYAN_ATOMIC_INCREMENT64(stats->reallocations);
+    ZyanStatsRecordResize(stats, old_size, size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanStatsExpand(ZyanAllocator* allocator, void* p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanStatsAllocator* const stats = (ZyanStatsAllocator*)allocator;
+    if (!stats->backing->expand)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    const ZyanUSize size = element_size * n;
+
+    ZyanUSize* const header = (ZyanUSize*)((ZyanU8*)p - ZYCORE_STATS_HEADER_SIZE);
+    const ZyanUSize old_size = *header;
+    const ZyanStatus status = stats->backing->expand(stats->backing, header, sizeof(ZyanU8),
+        ZYCORE_STATS_HEADER_SIZE + size);
+    if (status == ZYAN_STATUS_TRUE)
+    {
+        *header = size;
+        ZYAN_ATOMIC_INCREMENT64(stats->expansions);
+        ZyanStatsRecordResize(stats, old_size, size);
+    }
+
+    return status;
+}
+
+static ZyanStatus ZyanStatsDeallocate(ZyanAllocator* allocator, void* p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(element_size);
+    ZYAN_UNUSED(n);
+
+    ZyanStatsAllocator* const stats = (ZyanStatsAllocator*)allocator;
+
+    ZyanUSize* const header = (ZyanUSize*)((ZyanU8*)p - ZYCORE_STATS_HEADER_SIZE);
+    const ZyanUSize size = *header;
+    ZYAN_CHECK(stats->backing->deallocate(stats->backing, header, sizeof(ZyanU8),
+        ZYCORE_STATS_HEADER_SIZE + size));
+
+    ZYAN_ATOMIC_INCREMENT64(stats->deallocations);
+    ZyanStatsAdd(&stats->live_bytes, (ZyanU64)0 - (ZyanU64)size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanStatsAllocatorInit(ZyanStatsAllocator* stats)
+{
+    return ZyanStatsAllocatorInitEx(stats, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanStatsAllocatorInitEx(ZyanStatsAllocator* stats, ZyanAllocator* backing)
+{
+    if (!stats || !backing)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanAllocatorInitEx(&stats->allocator, &ZyanStatsAllocate, &ZyanStatsReallocate,
+        &ZyanStatsDeallocate, &ZyanStatsExpand));
+
+    stats->backing = backing;
+    stats->allocations.value   = 0;
+    stats->reallocations.value = 0;
+    stats->expansions.value    = 0;
+    stats->deallocations.value = 0;
+    stats->live_bytes.value    = 0;
+    stats->peak_bytes.value    = 0;
+    for (ZyanUSize i = 0; i < ZYAN_STATS_HISTOGRAM_SIZE; ++i)
+    {
+        stats->histogram[i].value = 0;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Statistics                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanStatsAllocatorGetSnapshot(ZyanStatsAllocator* stats,
+    ZyanStatsAllocatorSnapshot* snapshot)
+{
+    if (!stats || !snapshot)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    snapshot->allocations   = ZyanStatsLoad(&stats->allocations);
+    snapshot->reallocations = ZyanStatsLoad(&stats->reallocations);
+    snapshot->expansions    = ZyanStatsLoad(&stats->expansions);
+    snapshot->deallocations = ZyanStatsLoad(&stats->deallocations);
+    snapshot->live_bytes    = ZyanStatsLoad(&stats->live_bytes);
+    snapshot->peak_bytes    = ZyanStatsLoad(&stats->peak_bytes);
+    for (ZyanUSize i = 0; i < ZYAN_STATS_HISTOGRAM_SIZE; ++i)
+    {
+        snapshot->histogram[i] = ZyanStatsLoad(&stats->histogram[i]);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanStatsAllocatorReset(ZyanStatsAllocator* stats)
+{
+    if (!stats)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanStatsStore(&stats->allocations, 0);
+    ZyanStatsStore(&stats->reallocations, 0);
+    ZyanStatsStore(&stats->expansions, 0);
+    ZyanStatsStore(&stats->deallocations, 0);
+    for (ZyanUSize i = 0; i < ZYAN_STATS_HISTOGRAM_SIZE; ++i)
+    {
+        ZyanStatsStore(&stats->histogram[i], 0);
+    }
+    ZyanStatsStore(&stats->peak_bytes, ZyanStatsLoad(&stats->live_bytes));
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
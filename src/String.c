@@ -24,6 +24,9 @@
 
 ***************************************************************************************************/
 
+// The exported functions in this file must not be replaced by the inline fast paths
+#undef ZYCORE_INLINE_FASTPATH
+
 #include <Zycore/String.h>
 #include <Zycore/LibC.h>
 
@@ -103,6 +106,39 @@ ZyanStatus ZyanStringInitCustomBuffer(ZyanString* string, char* buffer, ZyanUSiz
     return ZYAN_STATUS_SUCCESS;
 }
 
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanStringInitSmall(ZyanSmallString* string)
+{
+    return ZyanStringInitSmallEx(string, ZyanAllocatorDefault(),
+        ZYAN_STRING_DEFAULT_GROWTH_FACTOR, ZYAN_STRING_DEFAULT_SHRINK_THRESHOLD);
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanStringInitSmallEx(ZyanSmallString* string, ZyanAllocator* allocator,
+    ZyanU8 growth_factor, ZyanU8 shrink_threshold)
+{
+    if (!string)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanSmallBufferAllocatorInit(&string->allocator, string->buffer,
+        sizeof(string->buffer), allocator));
+
+    // The minimum string capacity is not enforced, as the inline buffer is the whole point
+    string->string.flags = 0;
+    ZYAN_CHECK(ZyanVectorInitEx(&string->string.vector, sizeof(char), sizeof(string->buffer),
+        ZYAN_NULL, &string->allocator.allocator, growth_factor, shrink_threshold));
+    ZYAN_ASSERT(string->string.vector.data == string->buffer);
+
+    *(char*)string->string.vector.data = '\0';
+    ++string->string.vector.size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
 ZyanStatus ZyanStringDestroy(ZyanString* string)
 {
     if (!string)
@@ -1051,6 +1087,16 @@ ZyanStatus ZyanStringShrinkToFit(ZyanString* string)
     return ZyanVectorShrinkToFit(&string->vector);
 }
 
+ZyanStatus ZyanStringSetGrowthPolicy(ZyanString* string, const ZyanVectorGrowthPolicy* policy)
+{
+    if (!string)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorSetGrowthPolicy(&string->vector, policy);
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Information                                                                                    */
 /* ---------------------------------------------------------------------------------------------- */
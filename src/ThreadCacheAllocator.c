@@ -0,0 +1,655 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/Atomic.h>
+#include <Zycore/LibC.h>
+#include <Zycore/ThreadCacheAllocator.h>
+
+#ifndef ZYAN_NO_LIBC
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanThreadCache` struct.
+ *
+ * The cache is owned by a single thread. Only the `remote_free` and `orphans` fields are
+ * accessed by other threads.
+ */
+typedef struct ZyanThreadCache_
+{
+    /**
+     * The backing allocator.
+     */
+    ZyanAllocator* backing;
+    /**
+     * The maximum number of blocks cached per size-class.
+     */
+    ZyanUSize magazine_size;
+    /**
+     * The heads of the per size-class free lists.
+     */
+    void* magazines[ZYAN_THREAD_CACHE_SIZE_CLASS_COUNT];
+    /**
+     * The number of blocks in each of the per size-class free lists.
+     */
+    ZyanUSize counts[ZYAN_THREAD_CACHE_SIZE_CLASS_COUNT];
+    /**
+     * The number of blocks owned by this cache that are currently handed out.
+     */
+    ZyanUSize outstanding;
+    /**
+     * The head of the lock-free list of blocks released by other threads or
+     * `ZYCORE_THREAD_CACHE_ABANDONED`, if the owning thread has exited.
+     */
+    ZyanAtomicPointer remote_free;
+    /**
+     * The number of blocks that are still handed out after the owning thread has exited. The
+     * cache itself is released as soon as this counter drops to zero.
+     */
+    ZyanAtomic64 orphans;
+} ZyanThreadCache;
+
+/**
+ * Defines the `ZyanThreadCacheBlockHeader` struct.
+ *
+ * The header is placed directly in front of each memory block.
+ */
+typedef struct ZyanThreadCacheBlockHeader_
+{
+    /**
+     * The cache owning the block or `ZYAN_NULL`, if the block was obtained directly from the
+     * backing allocator.
+     */
+    ZyanThreadCache* owner;
+    /**
+     * The size-class index of the block, or the size of the block (in bytes), if the block is not
+     * owned by a cache.
+     */
+    ZyanUSize size;
+} ZyanThreadCacheBlockHeader;
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * The size of the block header (in bytes), including padding.
+ */
+#define ZYCORE_THREAD_CACHE_HEADER_SIZE \
+    ZYAN_ALIGN_UP(sizeof(ZyanThreadCacheBlockHeader), ZYAN_THREAD_CACHE_ALIGNMENT)
+
+/**
+ * Returns a pointer to the header of the given memory block.
+ *
+ * @param   p   A pointer to the memory block.
+ *
+ * @return  A pointer to the header of the given memory block.
+ */
+#define ZYCORE_THREAD_CACHE_HEADER(p) \
+    ((ZyanThreadCacheBlockHeader*)((ZyanU8*)(p) - ZYCORE_THREAD_CACHE_HEADER_SIZE))
+
+/**
+ * Returns the size (in bytes) of the given size-class.
+ *
+ * @param   index   The size-class index.
+ *
+ * @return  The size (in bytes) of the given size-class.
+ */
+#define ZYCORE_THREAD_CACHE_CLASS_SIZE(index) \
+    ((ZyanUSize)ZYAN_THREAD_CACHE_MIN_BLOCK_SIZE << (index))
+
+/**
+ * The value stored in the remote-free list of a cache whose owning thread has exited.
+ *
+ * Block addresses are always aligned, so this value never collides with a valid list head.
+ */
+#define ZYCORE_THREAD_CACHE_ABANDONED   ((ZyanUPointer)1)
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the index of the smallest size-class that is able to hold `size` bytes.
+ *
+ * @param   size    The requested size (in bytes). Must not exceed
+ *                  `ZYAN_THREAD_CACHE_MAX_BLOCK_SIZE`.
+ *
+ * @return  The size-class index.
+ */
+static ZyanUSize ZyanThreadCacheGetSizeClass(ZyanUSize size)
+{
+    ZyanUSize index = 0;
+    while (ZYCORE_THREAD_CACHE_CLASS_SIZE(index) < size)
+    {
+        ++index;
+    }
+    ZYAN_ASSERT(index < ZYAN_THREAD_CACHE_SIZE_CLASS_COUNT);
+
+    return index;
+}
+
+/**
+ * Returns a memory block to the backing allocator.
+ *
+ * @param   backing A pointer to the backing allocator.
+ * @param   header  A pointer to the header of the memory block.
+ * @param   size    The size of the memory block (in bytes), excluding the header.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanThreadCacheReleaseBlock(ZyanAllocator* backing,
+    ZyanThreadCacheBlockHeader* header, ZyanUSize size)
+{
+    ZYAN_ASSERT(backing);
+    ZYAN_ASSERT(backing->deallocate);
+    ZYAN_ASSERT(header);
+
+    return backing->deallocate(backing, header, sizeof(ZyanU8),
+        ZYCORE_THREAD_CACHE_HEADER_SIZE + size);
+}
+
+/**
+ * Atomically detaches the remote-free list of the given cache.
+ *
+ * @param   cache       A pointer to the `ZyanThreadCache` struct.
+ * @param   replacement The new value of the list head.
+ *
+ * @return  The previous head of the remote-free list.
+ */
+static void* ZyanThreadCacheDetachRemote(ZyanThreadCache* cache, ZyanUPointer replacement)
+{
+    ZYAN_ASSERT(cache);
+
+    ZyanUPointer head = (ZyanUPointer)cache->remote_free.value;
+    for (;;)
+    {
+        const ZyanUPointer previous =
+            ZyanAtomicCompareExchange(&cache->remote_free, head, replacement);
+        if (previous == head)
+        {
+            break;
+        }
+        head = previous;
+    }
+
+    return (void*)head;
+}
+
+/**
+ * Moves all blocks from the remote-free list into the magazines of the given cache.
+ *
+ * @param   cache   A pointer to the `ZyanThreadCache` struct.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanThreadCacheDrainRemote(ZyanThreadCache* cache)
+{
+    ZYAN_ASSERT(cache);
+
+    if (!cache->remote_free.value)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    void* block = ZyanThreadCacheDetachRemote(cache, 0);
+    while (block)
+    {
+        void* const next = *(void**)block;
+        ZyanThreadCacheBlockHeader* const header = ZYCORE_THREAD_CACHE_HEADER(block);
+        const ZyanUSize index = header->size;
+
+        if (cache->counts[index] < cache->magazine_size)
+        {
+            *(void**)block = cache->magazines[index];
+            cache->magazines[index] = block;
+            ++cache->counts[index];
+        } else
+        {
+            ZYAN_CHECK(ZyanThreadCacheReleaseBlock(cache->backing, header,
+                ZYCORE_THREAD_CACHE_CLASS_SIZE(index)));
+        }
+
+        --cache->outstanding;
+        block = next;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Returns all blocks in the magazines of the given cache to the backing allocator.
+ *
+ * @param   cache   A pointer to the `ZyanThreadCache` struct.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanThreadCacheReleaseMagazines(ZyanThreadCache* cache)
+{
+    ZYAN_ASSERT(cache);
+
+    for (ZyanUSize i = 0; i < ZYAN_THREAD_CACHE_SIZE_CLASS_COUNT; ++i)
+    {
+        void* block = cache->magazines[i];
+        while (block)
+        {
+            void* const next = *(void**)block;
+            ZYAN_CHECK(ZyanThreadCacheReleaseBlock(cache->backing,
+                ZYCORE_THREAD_CACHE_HEADER(block), ZYCORE_THREAD_CACHE_CLASS_SIZE(i)));
+            block = next;
+        }
+        cache->magazines[i] = ZYAN_NULL;
+        cache->counts[i] = 0;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Adjusts the orphan counter of the given abandoned cache and releases the cache once the counter
+ * drops to zero.
+ *
+ * @param   cache   A pointer to the `ZyanThreadCache` struct.
+ * @param   count   The number of orphaned blocks to add (positive) or drop (negative).
+ *
+ * @return  A zyan status code.
+ *
+ * The counter is allowed to temporarily wrap around, as remote threads may drop references
+ * before the exiting owner thread published the number of outstanding blocks.
+ */
+static ZyanStatus ZyanThreadCacheAddOrphans(ZyanThreadCache* cache, ZyanI64 count)
+{
+    ZYAN_ASSERT(cache);
+
+    ZyanU64 value = cache->orphans.value;
+    for (;;)
+    {
+        const ZyanU64 previous =
+            ZyanAtomicCompareExchange64(&cache->orphans, value, value + (ZyanU64)count);
+        if (previous == value)
+        {
+            break;
+        }
+        value = previous;
+    }
+
+    if (value + (ZyanU64)count == 0)
+    {
+        ZYAN_ASSERT(cache->backing->deallocate);
+        return cache->backing->deallocate(cache->backing, cache, sizeof(ZyanThreadCache), 1);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Releases the given cache when its owning thread exits.
+ *
+ * @param   data    A pointer to the `ZyanThreadCache` struct.
+ */
+static ZYAN_THREAD_DECLARE_TLS_CALLBACK(ZyanThreadCacheRelease, void, data)
+{
+    ZyanThreadCache* const cache = (ZyanThreadCache*)data;
+    if (!cache)
+    {
+        return;
+    }
+
+    // From now on, remote threads return blocks directly to the backing allocator
+    void* block = ZyanThreadCacheDetachRemote(cache, ZYCORE_THREAD_CACHE_ABANDONED);
+    while (block)
+    {
+        void* const next = *(void**)block;
+        ZyanThreadCacheBlockHeader* const header = ZYCORE_THREAD_CACHE_HEADER(block);
+        ZyanThreadCacheReleaseBlock(cache->backing, header,
+            ZYCORE_THREAD_CACHE_CLASS_SIZE(header->size));
+        --cache->outstanding;
+        block = next;
+    }
+
+    ZyanThreadCacheReleaseMagazines(cache);
+    ZyanThreadCacheAddOrphans(cache, (ZyanI64)cache->outstanding);
+}
+
+/**
+ * Returns the cache of the calling thread.
+ *
+ * @param   allocator   A pointer to the `ZyanThreadCacheAllocator` instance.
+ * @param   cache       Receives a pointer to the cache of the calling thread.
+ * @param   create      `ZYAN_TRUE` to create the cache, if it does not exist yet.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanThreadCacheGet(ZyanThreadCacheAllocator* allocator,
+    ZyanThreadCache** cache, ZyanBool create)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(cache);
+
+    ZYAN_CHECK(ZyanThreadTlsGetValue(allocator->tls_index, (void**)cache));
+    if (*cache || !create)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZYAN_ASSERT(allocator->backing->allocate);
+
+    ZyanThreadCache* value;
+    ZYAN_CHECK(allocator->backing->allocate(allocator->backing, (void**)&value,
+        sizeof(ZyanThreadCache), 1));
+    ZYAN_MEMSET(value, 0, sizeof(ZyanThreadCache));
+    value->backing = allocator->backing;
+    value->magazine_size = allocator->magazine_size;
+
+    const ZyanStatus status = ZyanThreadTlsSetValue(allocator->tls_index, value);
+    if (!ZYAN_SUCCESS(status))
+    {
+        allocator->backing->deallocate(allocator->backing, value, sizeof(ZyanThreadCache), 1);
+        return status;
+    }
+
+    *cache = value;
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Allocator callbacks                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+static ZyanStatus ZyanThreadCacheAllocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanThreadCacheAllocator* const tca = (ZyanThreadCacheAllocator*)allocator;
+    const ZyanUSize size = element_size * n;
+    ZyanThreadCacheBlockHeader* header;
+
+    if (size > ZYAN_THREAD_CACHE_MAX_BLOCK_SIZE)
+    {
+        ZYAN_CHECK(tca->backing->allocate(tca->backing, (void**)&header, sizeof(ZyanU8),
+            ZYCORE_THREAD_CACHE_HEADER_SIZE + size));
+        header->owner = ZYAN_NULL;
+        header->size  = size;
+        *p = (ZyanU8*)header + ZYCORE_THREAD_CACHE_HEADER_SIZE;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZyanThreadCache* cache;
+    ZYAN_CHECK(ZyanThreadCacheGet(tca, &cache, ZYAN_TRUE));
+
+    const ZyanUSize index = ZyanThreadCacheGetSizeClass(size);
+    if (!cache->magazines[index])
+    {
+        ZYAN_CHECK(ZyanThreadCacheDrainRemote(cache));
+    }
+
+    void* const block = cache->magazines[index];
+    if (block)
+    {
+        cache->magazines[index] = *(void**)block;
+        --cache->counts[index];
+        ++cache->outstanding;
+        *p = block;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZYAN_CHECK(tca->backing->allocate(tca->backing, (void**)&header, sizeof(ZyanU8),
+        ZYCORE_THREAD_CACHE_HEADER_SIZE + ZYCORE_THREAD_CACHE_CLASS_SIZE(index)));
+    header->owner = cache;
+    header->size  = index;
+    ++cache->outstanding;
+    *p = (ZyanU8*)header + ZYCORE_THREAD_CACHE_HEADER_SIZE;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanThreadCacheDeallocate(ZyanAllocator* allocator, void* p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(element_size);
+    ZYAN_UNUSED(n);
+
+    ZyanThreadCacheAllocator* const tca = (ZyanThreadCacheAllocator*)allocator;
+    ZyanThreadCacheBlockHeader* const header = ZYCORE_THREAD_CACHE_HEADER(p);
+    ZyanThreadCache* const owner = header->owner;
+
+    if (!owner)
+    {
+        return ZyanThreadCacheReleaseBlock(tca->backing, header, header->size);
+    }
+
+    ZyanThreadCache* cache;
+    ZYAN_CHECK(ZyanThreadCacheGet(tca, &cache, ZYAN_FALSE));
+
+    const ZyanUSize index = header->size;
+    if (owner == cache)
+    {
+        --cache->outstanding;
+        if (cache->counts[index] < cache->magazine_size)
+        {
+            *(void**)p = cache->magazines[index];
+            cache->magazines[index] = p;
+            ++cache->counts[index];
+            return ZYAN_STATUS_SUCCESS;
+        }
+        return ZyanThreadCacheReleaseBlock(tca->backing, header,
+            ZYCORE_THREAD_CACHE_CLASS_SIZE(index));
+    }
+
+    // The block belongs to a different thread
+    ZyanUPointer head = (ZyanUPointer)owner->remote_free.value;
+    while (head != ZYCORE_THREAD_CACHE_ABANDONED)
+    {
+        *(void**)p = (void*)head;
+        const ZyanUPointer previous =
+            ZyanAtomicCompareExchange(&owner->remote_free, head, (ZyanUPointer)p);
+        if (previous == head)
+        {
+            return ZYAN_STATUS_SUCCESS;
+        }
+        head = previous;
+    }
+
+    ZYAN_CHECK(ZyanThreadCacheReleaseBlock(tca->backing, header,
+        ZYCORE_THREAD_CACHE_CLASS_SIZE(index)));
+    return ZyanThreadCacheAddOrphans(owner, -1);
+}
+
+static ZyanStatus ZyanThreadCacheExpand(ZyanAllocator* allocator, void* p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanThreadCacheAllocator* const tca = (ZyanThreadCacheAllocator*)allocator;
+    const ZyanUSize size = element_size * n;
+
+    ZyanThreadCacheBlockHeader* const header = ZYCORE_THREAD_CACHE_HEADER(p);
+    if (header->owner)
+    {
+        return (size <= ZYCORE_THREAD_CACHE_CLASS_SIZE(header->size)) ?
+            ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+    }
+
+    if ((size <= ZYAN_THREAD_CACHE_MAX_BLOCK_SIZE) || !tca->backing->expand)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    const ZyanStatus status = tca->backing->expand(tca->backing, header, sizeof(ZyanU8),
+        ZYCORE_THREAD_CACHE_HEADER_SIZE + size);
+    if (status == ZYAN_STATUS_TRUE)
+    {
+        header->size = size;
+    }
+
+    return status;
+}
+
+static ZyanStatus ZyanThreadCacheReallocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanThreadCacheAllocator* const tca = (ZyanThreadCacheAllocator*)allocator;
+    const ZyanUSize size = element_size * n;
+
+    if (!*p)
+    {
+        return ZyanThreadCacheAllocate(allocator, p, element_size, n);
+    }
+
+    ZyanThreadCacheBlockHeader* header = ZYCORE_THREAD_CACHE_HEADER(*p);
+    ZyanUSize capacity;
+    if (header->owner)
+    {
+        capacity = ZYCORE_THREAD_CACHE_CLASS_SIZE(header->size);
+        if (size <= capacity)
+        {
+            return ZYAN_STATUS_SUCCESS;
+        }
+    } else
+    {
+        if (size > ZYAN_THREAD_CACHE_MAX_BLOCK_SIZE)
+        {
+            ZYAN_CHECK(tca->backing->reallocate(tca->backing, (void**)&header, sizeof(ZyanU8),
+                ZYCORE_THREAD_CACHE_HEADER_SIZE + size));
+            header->size = size;
+            *p = (ZyanU8*)header + ZYCORE_THREAD_CACHE_HEADER_SIZE;
+            return ZYAN_STATUS_SUCCESS;
+        }
+        capacity = header->size;
+    }
+
+    void* block;
+    ZYAN_CHECK(ZyanThreadCacheAllocate(allocator, &block, element_size, n));
+    ZYAN_MEMCPY(block, *p, ZYAN_MIN(size, capacity));
+    ZYAN_CHECK(ZyanThreadCacheDeallocate(allocator, *p, sizeof(ZyanU8), capacity));
+    *p = block;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanThreadCacheInit(ZyanThreadCacheAllocator* allocator, ZyanUSize magazine_size)
+{
+    return ZyanThreadCacheInitEx(allocator, magazine_size, ZyanAllocatorDefault());
+}
+
+ZyanStatus ZyanThreadCacheInitEx(ZyanThreadCacheAllocator* allocator, ZyanUSize magazine_size,
+    ZyanAllocator* backing)
+{
+    if (!allocator || !backing)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanAllocatorInitEx(&allocator->allocator, &ZyanThreadCacheAllocate,
+        &ZyanThreadCacheReallocate, &ZyanThreadCacheDeallocate, &ZyanThreadCacheExpand));
+    ZYAN_CHECK(ZyanThreadTlsAlloc(&allocator->tls_index, &ZyanThreadCacheRelease));
+
+    allocator->backing       = backing;
+    allocator->magazine_size = magazine_size ? magazine_size :
+        ZYAN_THREAD_CACHE_DEFAULT_MAGAZINE_SIZE;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanThreadCacheDestroy(ZyanThreadCacheAllocator* allocator)
+{
+    if (!allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanThreadCache* cache;
+    ZYAN_CHECK(ZyanThreadCacheGet(allocator, &cache, ZYAN_FALSE));
+    if (cache)
+    {
+        // Clear the slot first, as some platforms invoke the destructor when the slot is freed
+        ZYAN_CHECK(ZyanThreadTlsSetValue(allocator->tls_index, ZYAN_NULL));
+        ZyanThreadCacheRelease(cache);
+    }
+
+    return ZyanThreadTlsFree(allocator->tls_index);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Cache management                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanThreadCacheFlush(ZyanThreadCacheAllocator* allocator)
+{
+    if (!allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanThreadCache* cache;
+    ZYAN_CHECK(ZyanThreadCacheGet(allocator, &cache, ZYAN_FALSE));
+    if (!cache)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZYAN_CHECK(ZyanThreadCacheDrainRemote(cache));
+    return ZyanThreadCacheReleaseMagazines(cache);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYAN_NO_LIBC */
@@ -0,0 +1,614 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/LibC.h>
+#include <Zycore/TlsfAllocator.h>
+#include <Zycore/Internal/BitScan.h>
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanTlsfBlock` struct.
+ *
+ * The block header is directly followed by the memory of the block. Free blocks additionally
+ * store their free list links in the first bytes of the block memory.
+ */
+typedef struct ZyanTlsfBlock_
+{
+    /**
+     * A pointer to the physically preceding block or `ZYAN_NULL`, if this is the first block of
+     * a region.
+     */
+    struct ZyanTlsfBlock_* prev_physical;
+    /**
+     * The size of the block memory (in bytes). The lowest bit is set, if the block is free.
+     */
+    ZyanUSize size;
+} ZyanTlsfBlock;
+
+/**
+ * Defines the `ZyanTlsfFreeLinks` struct.
+ */
+typedef struct ZyanTlsfFreeLinks_
+{
+    /**
+     * A pointer to the next block in the same free list.
+     */
+    ZyanTlsfBlock* next;
+    /**
+     * A pointer to the previous block in the same free list.
+     */
+    ZyanTlsfBlock* prev;
+} ZyanTlsfFreeLinks;
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * The size of the block header (in bytes), including padding.
+ */
+#define ZYCORE_TLSF_HEADER_SIZE \
+    ZYAN_ALIGN_UP(sizeof(ZyanTlsfBlock), ZYAN_TLSF_ALIGNMENT)
+
+/**
+ * The minimum size (in bytes) of the block memory, which has to fit the free list links.
+ */
+#define ZYCORE_TLSF_MIN_BLOCK_SIZE \
+    ZYAN_ALIGN_UP(sizeof(ZyanTlsfFreeLinks), ZYAN_TLSF_ALIGNMENT)
+
+/**
+ * The size (in bytes) below which all blocks share the first first-level size class.
+ */
+#define ZYCORE_TLSF_SMALL_BLOCK_SIZE    ((ZyanUSize)1 << ZYAN_TLSF_FL_SHIFT)
+
+/**
+ * The flag that marks a block as free.
+ */
+#define ZYCORE_TLSF_FLAG_FREE           ((ZyanUSize)1)
+
+/**
+ * Returns the size of the given block (in bytes).
+ *
+ * @param   block   A pointer to the `ZyanTlsfBlock` struct.
+ *
+ * @return  The size of the given block (in bytes).
+ */
+#define ZYCORE_TLSF_BLOCK_SIZE(block) \
+    ((block)->size & ~ZYCORE_TLSF_FLAG_FREE)
+
+/**
+ * Checks, if the given block is free.
+ *
+ * @param   block   A pointer to the `ZyanTlsfBlock` struct.
+ *
+ * @return  `ZYAN_TRUE`, if the block is free or `ZYAN_FALSE`, if not.
+ */
+#define ZYCORE_TLSF_BLOCK_IS_FREE(block) \
+    (((block)->size & ZYCORE_TLSF_FLAG_FREE) ? ZYAN_TRUE : ZYAN_FALSE)
+
+/**
+ * Returns a pointer to the memory of the given block.
+ *
+ * @param   block   A pointer to the `ZyanTlsfBlock` struct.
+ *
+ * @return  A pointer to the memory of the given block.
+ */
+#define ZYCORE_TLSF_BLOCK_DATA(block) \
+    ((void*)((ZyanU8*)(block) + ZYCORE_TLSF_HEADER_SIZE))
+
+/**
+ * Returns a pointer to the block header of the given memory block.
+ *
+ * @param   p   A pointer to the memory block.
+ *
+ * @return  A pointer to the `ZyanTlsfBlock` struct.
+ */
+#define ZYCORE_TLSF_BLOCK_FROM_DATA(p) \
+    ((ZyanTlsfBlock*)((ZyanU8*)(p) - ZYCORE_TLSF_HEADER_SIZE))
+
+/**
+ * Returns a pointer to the free list links of the given free block.
+ *
+ * @param   block   A pointer to the `ZyanTlsfBlock` struct.
+ *
+ * @return  A pointer to the `ZyanTlsfFreeLinks` struct.
+ */
+#define ZYCORE_TLSF_BLOCK_LINKS(block) \
+    ((ZyanTlsfFreeLinks*)ZYCORE_TLSF_BLOCK_DATA(block))
+
+/**
+ * Returns a pointer to the physically following block.
+ *
+ * @param   block   A pointer to the `ZyanTlsfBlock` struct.
+ *
+ * @return  A pointer to the physically following `ZyanTlsfBlock` struct.
+ */
+#define ZYCORE_TLSF_BLOCK_NEXT(block) \
+    ((ZyanTlsfBlock*)((ZyanU8*)(block) + ZYCORE_TLSF_HEADER_SIZE + ZYCORE_TLSF_BLOCK_SIZE(block)))
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Size class mapping                                                                             */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Calculates the size class that contains the given block size.
+ *
+ * @param   size    The block size (in bytes).
+ * @param   fl      Receives the first-level index.
+ * @param   sl      Receives the second-level index.
+ */
+static void ZyanTlsfMappingInsert(ZyanUSize size, ZyanU32* fl, ZyanU32* sl)
+{
+    ZYAN_ASSERT(fl);
+    ZYAN_ASSERT(sl);
+
+    if (size < ZYCORE_TLSF_SMALL_BLOCK_SIZE)
+    {
+        *fl = 0;
+        *sl = (ZyanU32)(size / (ZYCORE_TLSF_SMALL_BLOCK_SIZE / ZYAN_TLSF_SL_COUNT));
+        return;
+    }
+
+    const ZyanU32 msb = ZyanBitScanReverse(size);
+    *sl = (ZyanU32)(size >> (msb - ZYAN_TLSF_SL_COUNT_LOG2)) ^ ZYAN_TLSF_SL_COUNT;
+    *fl = msb - (ZYAN_TLSF_FL_SHIFT - 1);
+}
+
+/**
+ * Calculates the smallest size class whose blocks are all large enough for the given size.
+ *
+ * @param   size    The requested size (in bytes).
+ * @param   fl      Receives the first-level index.
+ * @param   sl      Receives the second-level index.
+ *
+ * Rounding the size up to the next size class boundary guarantees that any block of the
+ * resulting class fits, which avoids searching inside a free list.
+ */
+static void ZyanTlsfMappingSearch(ZyanUSize size, ZyanU32* fl, ZyanU32* sl)
+{
+    if (size >= ZYCORE_TLSF_SMALL_BLOCK_SIZE)
+    {
+        size += ((ZyanUSize)1 << (ZyanBitScanReverse(size) - ZYAN_TLSF_SL_COUNT_LOG2)) - 1;
+    }
+    ZyanTlsfMappingInsert(size, fl, sl);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Free lists                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Inserts the given block into the matching free list and marks it as free.
+ *
+ * @param   tlsf    A pointer to the `ZyanTlsfAllocator` instance.
+ * @param   block   A pointer to the `ZyanTlsfBlock` struct.
+ */
+static void ZyanTlsfInsertFree(ZyanTlsfAllocator* tlsf, ZyanTlsfBlock* block)
+{
+    ZYAN_ASSERT(tlsf);
+    ZYAN_ASSERT(block);
+
+    ZyanU32 fl, sl;
+    ZyanTlsfMappingInsert(ZYCORE_TLSF_BLOCK_SIZE(block), &fl, &sl);
+
+    ZyanTlsfBlock* const head = tlsf->free_lists[fl][sl];
+    ZYCORE_TLSF_BLOCK_LINKS(block)->next = head;
+    ZYCORE_TLSF_BLOCK_LINKS(block)->prev = ZYAN_NULL;
+    if (head)
+    {
+        ZYCORE_TLSF_BLOCK_LINKS(head)->prev = block;
+    }
+    tlsf->free_lists[fl][sl] = block;
+    tlsf->fl_bitmap |= (ZyanU32)1 << fl;
+    tlsf->sl_bitmap[fl] |= (ZyanU32)1 << sl;
+
+    block->size |= ZYCORE_TLSF_FLAG_FREE;
+}
+
+/**
+ * Removes the given block from its free list and marks it as used.
+ *
+ * @param   tlsf    A pointer to the `ZyanTlsfAllocator` instance.
+ * @param   block   A pointer to the `ZyanTlsfBlock` struct.
+ */
+static void ZyanTlsfRemoveFree(ZyanTlsfAllocator* tlsf, ZyanTlsfBlock* block)
+{
+    ZYAN_ASSERT(tlsf);
+    ZYAN_ASSERT(block);
+    ZYAN_ASSERT(ZYCORE_TLSF_BLOCK_IS_FREE(block));
+
+    ZyanU32 fl, sl;
+    ZyanTlsfMappingInsert(ZYCORE_TLSF_BLOCK_SIZE(block), &fl, &sl);
+
+    ZyanTlsfBlock* const next = ZYCORE_TLSF_BLOCK_LINKS(block)->next;
+    ZyanTlsfBlock* const prev = ZYCORE_TLSF_BLOCK_LINKS(block)->prev;
+    if (next)
+    {
+        ZYCORE_TLSF_BLOCK_LINKS(next)->prev = prev;
+    }
+    if (prev)
+    {
+        ZYCORE_TLSF_BLOCK_LINKS(prev)->next = next;
+    } else
+    {
+        tlsf->free_lists[fl][sl] = next;
+        if (!next)
+        {
+            tlsf->sl_bitmap[fl] &= ~((ZyanU32)1 << sl);
+            if (!tlsf->sl_bitmap[fl])
+            {
+                tlsf->fl_bitmap &= ~((ZyanU32)1 << fl);
+            }
+        }
+    }
+
+    block->size &= ~ZYCORE_TLSF_FLAG_FREE;
+}
+
+/**
+ * Finds and removes a free block that is large enough for the given size.
+ *
+ * @param   tlsf    A pointer to the `ZyanTlsfAllocator` instance.
+ * @param   size    The adjusted size (in bytes).
+ *
+ * @return  A pointer to the `ZyanTlsfBlock` struct or `ZYAN_NULL`, if no suitable block exists.
+ */
+static ZyanTlsfBlock* ZyanTlsfFindFree(ZyanTlsfAllocator* tlsf, ZyanUSize size)
+{
+    ZYAN_ASSERT(tlsf);
+
+    ZyanU32 fl, sl;
+    ZyanTlsfMappingSearch(size, &fl, &sl);
+    if (fl >= ZYAN_TLSF_FL_COUNT)
+    {
+        return ZYAN_NULL;
+    }
+
+    ZyanU32 sl_map = tlsf->sl_bitmap[fl] & (~(ZyanU32)0 << sl);
+    if (!sl_map)
+    {
+        const ZyanU32 fl_map = tlsf->fl_bitmap & (~(ZyanU32)0 << (fl + 1));
+        if (!fl_map)
+        {
+            return ZYAN_NULL;
+        }
+        fl = ZyanBitScanForward32(fl_map);
+        sl_map = tlsf->sl_bitmap[fl];
+    }
+    sl = ZyanBitScanForward32(sl_map);
+
+    ZyanTlsfBlock* const block = tlsf->free_lists[fl][sl];
+    ZYAN_ASSERT(block && (ZYCORE_TLSF_BLOCK_SIZE(block) >= size));
+    ZyanTlsfRemoveFree(tlsf, block);
+
+    return block;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Blocks                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the adjusted block size for the given allocation size.
+ *
+ * @param   size    The requested size (in bytes).
+ *
+ * @return  The adjusted block size (in bytes) or `0`, if the size is too large.
+ */
+static ZyanUSize ZyanTlsfAdjustSize(ZyanUSize size)
+{
+    if (size > ZYAN_TLSF_MAX_BLOCK_SIZE)
+    {
+        return 0;
+    }
+
+    return ZYAN_MAX(ZYAN_ALIGN_UP(size, ZYAN_TLSF_ALIGNMENT), ZYCORE_TLSF_MIN_BLOCK_SIZE);
+}
+
+/**
+ * Merges the given block with its physically following block.
+ *
+ * @param   block   A pointer to the `ZyanTlsfBlock` struct.
+ * @param   next    A pointer to the physically following `ZyanTlsfBlock` struct, which must not
+ *                  be part of any free list.
+ */
+static void ZyanTlsfMergeNext(ZyanTlsfBlock* block, ZyanTlsfBlock* next)
+{
+    ZYAN_ASSERT(block);
+    ZYAN_ASSERT(next);
+    ZYAN_ASSERT(ZYCORE_TLSF_BLOCK_NEXT(block) == next);
+
+    block->size += ZYCORE_TLSF_HEADER_SIZE + ZYCORE_TLSF_BLOCK_SIZE(next);
+    ZYCORE_TLSF_BLOCK_NEXT(block)->prev_physical = block;
+}
+
+/**
+ * Trims the given used block to the given size and releases the remainder, if it is large
+ * enough to form a block on its own.
+ *
+ * @param   tlsf    A pointer to the `ZyanTlsfAllocator` instance.
+ * @param   block   A pointer to the used `ZyanTlsfBlock` struct.
+ * @param   size    The adjusted size (in bytes).
+ */
+static void ZyanTlsfTrim(ZyanTlsfAllocator* tlsf, ZyanTlsfBlock* block, ZyanUSize size)
+{
+    ZYAN_ASSERT(tlsf);
+    ZYAN_ASSERT(block);
+    ZYAN_ASSERT(!ZYCORE_TLSF_BLOCK_IS_FREE(block));
+
+    const ZyanUSize block_size = ZYCORE_TLSF_BLOCK_SIZE(block);
+    if (block_size < size + ZYCORE_TLSF_HEADER_SIZE + ZYCORE_TLSF_MIN_BLOCK_SIZE)
+    {
+        return;
+    }
+
+    ZyanTlsfBlock* const remainder =
+        (ZyanTlsfBlock*)((ZyanU8*)ZYCORE_TLSF_BLOCK_DATA(block) + size);
+    remainder->prev_physical = block;
+    remainder->size = block_size - size - ZYCORE_TLSF_HEADER_SIZE;
+    block->size = size;
+
+    // The following block might be free, so the remainder is merged to keep the invariant that
+    // no two free blocks are adjacent
+    ZyanTlsfBlock* const next = ZYCORE_TLSF_BLOCK_NEXT(remainder);
+    next->prev_physical = remainder;
+    if (ZYCORE_TLSF_BLOCK_IS_FREE(next))
+    {
+        ZyanTlsfRemoveFree(tlsf, next);
+        ZyanTlsfMergeNext(remainder, next);
+    }
+    ZyanTlsfInsertFree(tlsf, remainder);
+}
+
+/**
+ * Tries to grow the given used block in place by absorbing the physically following block.
+ *
+ * @param   tlsf    A pointer to the `ZyanTlsfAllocator` instance.
+ * @param   block   A pointer to the used `ZyanTlsfBlock` struct.
+ * @param   size    The adjusted size (in bytes).
+ *
+ * @return  `ZYAN_TRUE`, if the block is now at least `size` bytes large or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanTlsfGrow(ZyanTlsfAllocator* tlsf, ZyanTlsfBlock* block, ZyanUSize size)
+{
+    ZYAN_ASSERT(tlsf);
+    ZYAN_ASSERT(block);
+
+    if (ZYCORE_TLSF_BLOCK_SIZE(block) >= size)
+    {
+        return ZYAN_TRUE;
+    }
+
+    ZyanTlsfBlock* const next = ZYCORE_TLSF_BLOCK_NEXT(block);
+    if (!ZYCORE_TLSF_BLOCK_IS_FREE(next) ||
+        (ZYCORE_TLSF_BLOCK_SIZE(block) + ZYCORE_TLSF_HEADER_SIZE + ZYCORE_TLSF_BLOCK_SIZE(next) <
+            size))
+    {
+        return ZYAN_FALSE;
+    }
+
+    ZyanTlsfRemoveFree(tlsf, next);
+    ZyanTlsfMergeNext(block, next);
+    ZyanTlsfTrim(tlsf, block, size);
+
+    return ZYAN_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Allocator callbacks                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+static ZyanStatus ZyanTlsfAllocate(ZyanAllocator* allocator, void** p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanTlsfAllocator* const tlsf = (ZyanTlsfAllocator*)allocator;
+
+    const ZyanUSize size = ZyanTlsfAdjustSize(element_size * n);
+    if (!size)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    ZyanTlsfBlock* const block = ZyanTlsfFindFree(tlsf, size);
+    if (!block)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+    ZyanTlsfTrim(tlsf, block, size);
+
+    *p = ZYCORE_TLSF_BLOCK_DATA(block);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanTlsfDeallocate(ZyanAllocator* allocator, void* p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(element_size);
+    ZYAN_UNUSED(n);
+
+    ZyanTlsfAllocator* const tlsf = (ZyanTlsfAllocator*)allocator;
+
+    ZyanTlsfBlock* block = ZYCORE_TLSF_BLOCK_FROM_DATA(p);
+    ZYAN_ASSERT(!ZYCORE_TLSF_BLOCK_IS_FREE(block));
+
+    ZyanTlsfBlock* const next = ZYCORE_TLSF_BLOCK_NEXT(block);
+    if (ZYCORE_TLSF_BLOCK_IS_FREE(next))
+    {
+        ZyanTlsfRemoveFree(tlsf, next);
+        ZyanTlsfMergeNext(block, next);
+    }
+    ZyanTlsfBlock* const prev = block->prev_physical;
+    if (prev && ZYCORE_TLSF_BLOCK_IS_FREE(prev))
+    {
+        ZyanTlsfRemoveFree(tlsf, prev);
+        ZyanTlsfMergeNext(prev, block);
+        block = prev;
+    }
+    ZyanTlsfInsertFree(tlsf, block);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanTlsfExpand(ZyanAllocator* allocator, void* p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanTlsfAllocator* const tlsf = (ZyanTlsfAllocator*)allocator;
+
+    const ZyanUSize size = ZyanTlsfAdjustSize(element_size * n);
+    if (!size)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    return ZyanTlsfGrow(tlsf, ZYCORE_TLSF_BLOCK_FROM_DATA(p), size) ?
+        ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+static ZyanStatus ZyanTlsfReallocate(ZyanAllocator* allocator, void** p, ZyanUSize element_size,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    if (!*p)
+    {
+        return ZyanTlsfAllocate(allocator, p, element_size, n);
+    }
+
+    ZyanTlsfAllocator* const tlsf = (ZyanTlsfAllocator*)allocator;
+
+    const ZyanUSize size = ZyanTlsfAdjustSize(element_size * n);
+    if (!size)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    ZyanTlsfBlock* const block = ZYCORE_TLSF_BLOCK_FROM_DATA(*p);
+    if (ZyanTlsfGrow(tlsf, block, size))
+    {
+        // Shrinking releases the tail of the block
+        ZyanTlsfTrim(tlsf, block, size);
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    void* x;
+    ZYAN_CHECK(ZyanTlsfAllocate(allocator, &x, element_size, n));
+    ZYAN_MEMCPY(x, *p, ZYCORE_TLSF_BLOCK_SIZE(block));
+    ZYAN_CHECK(ZyanTlsfDeallocate(allocator, *p, element_size, n));
+    *p = x;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanTlsfInit(ZyanTlsfAllocator* tlsf, void* buffer, ZyanUSize capacity)
+{
+    if (!tlsf)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanAllocatorInitEx(&tlsf->allocator, &ZyanTlsfAllocate, &ZyanTlsfReallocate,
+        &ZyanTlsfDeallocate, &ZyanTlsfExpand));
+
+    tlsf->fl_bitmap = 0;
+    ZYAN_MEMSET(tlsf->sl_bitmap, 0, sizeof(tlsf->sl_bitmap));
+    ZYAN_MEMSET(tlsf->free_lists, 0, sizeof(tlsf->free_lists));
+
+    return ZyanTlsfAddRegion(tlsf, buffer, capacity);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Regions                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanTlsfAddRegion(ZyanTlsfAllocator* tlsf, void* buffer, ZyanUSize capacity)
+{
+    if (!tlsf || !buffer)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUPointer start = ZYAN_ALIGN_UP((ZyanUPointer)buffer, ZYAN_TLSF_ALIGNMENT);
+    const ZyanUPointer end =
+        ((ZyanUPointer)buffer + capacity) & ~(ZyanUPointer)(ZYAN_TLSF_ALIGNMENT - 1);
+    if ((end <= start) ||
+        (end - start < 2 * ZYCORE_TLSF_HEADER_SIZE + ZYCORE_TLSF_MIN_BLOCK_SIZE))
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    // The region is terminated by a used zero-sized sentinel block, which stops merging at the
+    // end of the region
+    ZyanTlsfBlock* const block = (ZyanTlsfBlock*)start;
+    block->prev_physical = ZYAN_NULL;
+    block->size = ZYAN_MIN((ZyanUSize)(end - start) - 2 * ZYCORE_TLSF_HEADER_SIZE,
+        ZYAN_TLSF_MAX_BLOCK_SIZE);
+
+    ZyanTlsfBlock* const sentinel = ZYCORE_TLSF_BLOCK_NEXT(block);
+    sentinel->prev_physical = block;
+    sentinel->size = 0;
+
+    ZyanTlsfInsertFree(tlsf, block);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -24,8 +24,14 @@
 
 ***************************************************************************************************/
 
+// The exported functions in this file must not be replaced by the inline fast paths
+#undef ZYCORE_INLINE_FASTPATH
+
 #include <Zycore/LibC.h>
 #include <Zycore/Vector.h>
+#include <Zycore/API/Memory.h>
+#include <Zycore/API/Thread.h>
+#include <Zycore/Internal/BitScan.h>
 
 /* ============================================================================================== */
 /* Internal macros                                                                                */
@@ -65,10 +71,397 @@
 #define ZYCORE_VECTOR_OFFSET(vector, index) \
     ((void*)((ZyanU8*)(vector)->data + ((index) * (vector)->element_size)))
 
+/**
+ * Prefetches the cache line at the given `address` for reading.
+ *
+ * @param   address The address to prefetch. The address does not have to be valid.
+ */
+#if defined(ZYAN_GNUC)
+#   define ZYCORE_VECTOR_PREFETCH(address) \
+        __builtin_prefetch(address)
+#elif defined(ZYAN_MSVC) && (defined(ZYAN_X86) || defined(ZYAN_X64))
+#   include <intrin.h>
+#   define ZYCORE_VECTOR_PREFETCH(address) \
+        _mm_prefetch((const char*)(address), _MM_HINT_T0)
+#else
+#   define ZYCORE_VECTOR_PREFETCH(address) \
+        ZYAN_UNUSED(address)
+#endif
+
+/**
+ * Defined, if `ZyanVectorFindBytes` uses SSE2/AVX2 for element sizes of 1, 2, 4 and 8 bytes.
+ *
+ * Vector registers are not used without libc, as freestanding environments like kernel drivers
+ * usually do not preserve the extended register state.
+ */
+#if !defined(ZYAN_NO_LIBC) && (defined(ZYAN_X86) || defined(ZYAN_X64)) && \
+    (defined(ZYAN_GNUC) || defined(ZYAN_MSVC))
+#   define ZYCORE_VECTOR_FIND_SIMD
+#   include <immintrin.h>
+#   if defined(ZYAN_MSVC)
+#       include <intrin.h>
+#   endif
+#endif
+
+/**
+ * Enables the given instruction set extensions for a single function.
+ *
+ * @param   features    The target features (e.g. `"avx2"`).
+ */
+#if defined(ZYAN_GNUC)
+#   define ZYCORE_VECTOR_TARGET(features) \
+        __attribute__((target(features)))
+#else
+#   define ZYCORE_VECTOR_TARGET(features)
+#endif
+
+/**
+ * The number of tree levels the Eytzinger search prefetches ahead.
+ *
+ * The `2^4 = 16` descendants four levels below a node are stored next to each other and
+ * usually share a single cache line.
+ */
+#define ZYCORE_VECTOR_EYTZINGER_PREFETCH_LEVELS 4
+
+/**
+ * The number of independent searches `ZyanVectorBinarySearchBatch` interleaves for unsorted keys.
+ */
+#define ZYCORE_VECTOR_SEARCH_BATCH_WIDTH        8
+
+/**
+ * Returns a pointer to the element at the given `index` of a range that is being sorted.
+ *
+ * @param   base    A `ZyanU8` pointer to the first element of the range.
+ * @param   index   The element index.
+ * @param   size    The size of a single element in bytes.
+ *
+ * @return  A `ZyanU8` pointer to the element at the given `index`.
+ */
+#define ZYCORE_VECTOR_SORT_ELEMENT(base, index, size) \
+    ((base) + (index) * (size))
+
+/**
+ * The maximum number of elements sorted using insertion sort.
+ */
+#define ZYCORE_VECTOR_SORT_INSERTION_THRESHOLD  16
+
+/**
+ * The minimum number of elements for the pivot to be selected as pseudo-median of nine.
+ */
+#define ZYCORE_VECTOR_SORT_NINTHER_THRESHOLD    128
+
+/**
+ * The minimum number of elements for the radix sort to be used.
+ */
+#define ZYCORE_VECTOR_SORT_RADIX_THRESHOLD      64
+
+/**
+ * The maximum number of threads used by `ZyanVectorSortParallel`.
+ */
+#define ZYCORE_VECTOR_SORT_MAX_THREADS          64
+
+/**
+ * The minimum number of elements sorted by a single thread in `ZyanVectorSortParallel`.
+ */
+#define ZYCORE_VECTOR_SORT_MIN_CHUNK            4096
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * The size of the header in front of the data of virtual memory backed vectors (in bytes).
+ */
+#define ZYCORE_VECTOR_VIRTUAL_HEADER_SIZE   64
+
+/**
+ * The minimum amount of memory (in bytes) committed at once for virtual memory backed vectors.
+ */
+#define ZYCORE_VECTOR_VIRTUAL_COMMIT_STEP   (64 * 1024)
+
+/**
+ * Returns a pointer to the header of a virtual memory backed vector.
+ *
+ * @param   data    The data pointer of the vector.
+ *
+ * @return  A pointer to the `ZyanVectorVirtualHeader` struct.
+ */
+#define ZYCORE_VECTOR_VIRTUAL_HEADER(data) \
+    ((ZyanVectorVirtualHeader*)((ZyanU8*)(data) - ZYCORE_VECTOR_VIRTUAL_HEADER_SIZE))
+
+#endif // ZYAN_NO_LIBC
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Defines the `ZyanVectorVirtualHeader` struct.
+ *
+ * The header is placed at the start of the reserved address range of virtual memory backed
+ * vectors and is directly followed by the vector data.
+ */
+typedef struct ZyanVectorVirtualHeader_
+{
+    /**
+     * The size of the reserved address range (in bytes), including the header.
+     */
+    ZyanUSize reserved;
+    /**
+     * The size of the committed part of the address range (in bytes), including the header.
+     */
+    ZyanUSize committed;
+    /**
+     * The commit granularity (in bytes).
+     */
+    ZyanUSize granularity;
+    /**
+     * The maximum capacity (number of elements) of the vector.
+     */
+    ZyanUSize max_capacity;
+} ZyanVectorVirtualHeader;
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Defines the `ZyanVectorSortContext` struct.
+ *
+ * Elements are either compared using the `comparison` callback or, if no callback is set, by
+ * the unsigned integer key at `key_offset`.
+ */
+typedef struct ZyanVectorSortContext_
+{
+    /**
+     * The comparison callback or `ZYAN_NULL`.
+     */
+    ZyanComparison comparison;
+    /**
+     * The offset of the key inside an element (in bytes).
+     */
+    ZyanUSize key_offset;
+    /**
+     * The size of the key (in bytes).
+     */
+    ZyanUSize key_size;
+    /**
+     * The size of a single element in bytes.
+     */
+    ZyanUSize element_size;
+} ZyanVectorSortContext;
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Defines the `ZyanVectorSortTask` struct.
+ *
+ * A task describes the share of a single thread in one phase of a parallel sort. In the first
+ * phase, each thread sorts one run in-place. In each of the following phases, pairs of adjacent
+ * runs are merged from `source` to `destination` and each thread produces an equally sized part
+ * of the output.
+ */
+typedef struct ZyanVectorSortTask_
+{
+    /**
+     * The sort context.
+     */
+    const ZyanVectorSortContext* context;
+    /**
+     * The source buffer.
+     */
+    ZyanU8* source;
+    /**
+     * The destination buffer or `ZYAN_NULL`, if a sorted run should not be copied.
+     */
+    ZyanU8* destination;
+    /**
+     * The start indices of all runs, followed by the total number of elements.
+     */
+    const ZyanUSize* bounds;
+    /**
+     * The number of runs to merge or `0` for the initial sort phase.
+     */
+    ZyanUSize run_count;
+    /**
+     * The index of the first element of this task.
+     */
+    ZyanUSize begin;
+    /**
+     * The index behind the last element of this task.
+     */
+    ZyanUSize end;
+} ZyanVectorSortTask;
+
+#endif // ZYAN_NO_LIBC
+
 /* ============================================================================================== */
 /* Internal functions                                                                             */
 /* ============================================================================================== */
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Virtual memory allocator                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+static ZyanStatus ZyanVectorVirtualAllocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(allocator);
+    ZYAN_UNUSED(p);
+    ZYAN_UNUSED(element_size);
+    ZYAN_UNUSED(n);
+
+    // The address range is reserved by `ZyanVectorInitVirtual`
+    return ZYAN_STATUS_INVALID_OPERATION;
+}
+
+static ZyanStatus ZyanVectorVirtualReallocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(*p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(allocator);
+
+    ZyanVectorVirtualHeader* const header = ZYCORE_VECTOR_VIRTUAL_HEADER(*p);
+    if (n > header->max_capacity)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    const ZyanUSize required = ZYAN_MIN(header->reserved, ZYAN_ALIGN_UP(
+        ZYCORE_VECTOR_VIRTUAL_HEADER_SIZE + element_size * n, header->granularity));
+    ZyanU8* const base = (ZyanU8*)header;
+
+    // The data never moves; only the committed part of the reserved range changes
+    if (required > header->committed)
+    {
+        ZYAN_CHECK(ZyanMemoryVirtualCommit(base + header->committed,
+            required - header->committed, ZYAN_PAGE_READWRITE));
+    } else
+    if (required < header->committed)
+    {
+        ZYAN_CHECK(ZyanMemoryVirtualDecommit(base + required, header->committed - required));
+    }
+    header->committed = required;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanVectorVirtualDeallocate(ZyanAllocator* allocator, void* p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(allocator);
+    ZYAN_UNUSED(element_size);
+    ZYAN_UNUSED(n);
+
+    ZyanVectorVirtualHeader* const header = ZYCORE_VECTOR_VIRTUAL_HEADER(p);
+    return ZyanMemoryVirtualFree(header, header->reserved);
+}
+
+/**
+ * The allocator shared by all virtual memory backed vectors.
+ */
+static ZyanAllocator ZyanVectorVirtualAllocator =
+{
+    &ZyanVectorVirtualAllocate,
+    &ZyanVectorVirtualReallocate,
+    &ZyanVectorVirtualDeallocate,
+    ZYAN_NULL
+};
+
+#endif // ZYAN_NO_LIBC
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Growth policy                                                                                  */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Calculates the capacity a vector should be reallocated to, in order to store `size` elements.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ * @param   size    The desired size of the vector.
+ *
+ * @return  The new capacity of the vector.
+ */
+static ZyanUSize ZyanVectorCalculateCapacity(const ZyanVector* vector, ZyanUSize size)
+{
+    ZYAN_ASSERT(vector);
+
+    const ZyanVectorGrowthPolicy* const policy = vector->growth_policy;
+    if (!policy)
+    {
+        return ZYAN_MAX(1, (ZyanUSize)(size * vector->growth_factor));
+    }
+
+    const ZyanUSize denominator = policy->growth_denominator;
+    const ZyanUSize extra = policy->growth_numerator - policy->growth_denominator;
+    ZyanUSize growth = (size / denominator) * extra +
+        ((size % denominator) * extra + denominator - 1) / denominator;
+    if (policy->max_growth_step)
+    {
+        growth = ZYAN_MIN(growth, ZYAN_MAX(1, policy->max_growth_step / vector->element_size));
+    }
+
+    ZyanUSize capacity = ZYAN_MAX(1, size + growth);
+    const ZyanUSize bytes = capacity * vector->element_size;
+    if (policy->page_size && (bytes >= policy->page_threshold))
+    {
+        capacity = ZYAN_ALIGN_UP(bytes, policy->page_size) / vector->element_size;
+    }
+
+    return capacity;
+}
+
+/**
+ * Checks, if the passed vector should shrink after its size was reduced to `size` and updates
+ * the shrink hysteresis state.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ * @param   size    The new size of the vector.
+ *
+ * @return  `ZYAN_TRUE`, if the vector should shrink or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanVectorShouldShrink(ZyanVector* vector, ZyanUSize size)
+{
+    ZYAN_ASSERT(vector);
+
+    const ZyanVectorGrowthPolicy* const policy = vector->growth_policy;
+    if (!policy)
+    {
+        return ZYCORE_VECTOR_SHOULD_SHRINK(size, vector->capacity, vector->shrink_threshold);
+    }
+
+    if (!ZYCORE_VECTOR_SHOULD_SHRINK(size, vector->capacity, policy->shrink_threshold))
+    {
+        vector->shrink_pending = 0;
+        return ZYAN_FALSE;
+    }
+
+    // Delay shrinking until the vector stayed under-occupied for a while to avoid reallocation
+    // thrashing, if the size oscillates around the threshold
+    if (++vector->shrink_pending < policy->shrink_delay)
+    {
+        return ZYAN_FALSE;
+    }
+    vector->shrink_pending = 0;
+
+    return (ZyanVectorCalculateCapacity(vector, size) < vector->capacity);
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Helper functions                                                                               */
 /* ---------------------------------------------------------------------------------------------- */
@@ -111,9 +504,38 @@ static ZyanStatus ZyanVectorReallocate(ZyanVector* vector, ZyanUSize capacity)
         }
     }
 
-    vector->capacity = capacity;
+#ifndef ZYAN_NO_LIBC
+    if (vector->allocator == &ZyanVectorVirtualAllocator)
+    {
+        // Make all committed memory available, as growing beyond it requires a system call, but
+        // never exceed the maximum capacity the vector was created with
+        ZYAN_CHECK(ZyanVectorVirtualReallocate(vector->allocator, &vector->data,
+            vector->element_size, capacity));
+        const ZyanVectorVirtualHeader* const header = ZYCORE_VECTOR_VIRTUAL_HEADER(vector->data);
+        vector->capacity = ZYAN_MIN(header->max_capacity,
+            (header->committed - ZYCORE_VECTOR_VIRTUAL_HEADER_SIZE) / vector->element_size);
+        return ZYAN_STATUS_SUCCESS;
+    }
+#endif
+
+    if (vector->allocator->expand && (capacity > vector->capacity))
+    {
+        // Growing the memory block in place avoids the potential copy in `reallocate`
+        const ZyanStatus status = vector->allocator->expand(vector->allocator, vector->data,
+            vector->element_size, capacity);
+        ZYAN_CHECK(status);
+        if (status == ZYAN_STATUS_TRUE)
+        {
+            vector->capacity = capacity;
+            return ZYAN_STATUS_SUCCESS;
+        }
+    }
+
+    // The capacity is only updated on success, so the vector stays usable if the allocator runs
+    // out of memory
     ZYAN_CHECK(vector->allocator->reallocate(vector->allocator, &vector->data,
-        vector->element_size, vector->capacity));
+        vector->element_size, capacity));
+    vector->capacity = capacity;
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -144,31 +566,933 @@ static ZyanStatus ZyanVectorShiftLeft(ZyanVector* vector, ZyanUSize index, ZyanU
 }
 
 /**
- * Shifts all elements starting at the specified `index` by the amount of `count` to the right.
+ * Shifts all elements starting at the specified `index` by the amount of `count` to the right.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ * @param   index   The start index.
+ * @param   count   The amount of shift operations.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanVectorShiftRight(ZyanVector* vector, ZyanUSize index, ZyanUSize count)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(vector->element_size);
+    ZYAN_ASSERT(vector->data);
+    ZYAN_ASSERT(count > 0);
+    ZYAN_ASSERT(vector->size + count <= vector->capacity);
+
+    const void* const source = ZYCORE_VECTOR_OFFSET(vector, index);
+    void* const dest         = ZYCORE_VECTOR_OFFSET(vector, index + count);
+    const ZyanUSize size     = (vector->size - index) * vector->element_size;
+    ZYAN_MEMMOVE(dest, source, size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Sorting                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Reads the integer key of the given element.
+ *
+ * @param   context A pointer to the `ZyanVectorSortContext` struct.
+ * @param   element A pointer to the element.
+ *
+ * @return  The key of the element.
+ */
+static ZyanU64 ZyanVectorSortReadKey(const ZyanVectorSortContext* context, const void* element)
+{
+    ZYAN_ASSERT(context);
+    ZYAN_ASSERT(element);
+
+    const ZyanU8* const key = (const ZyanU8*)element + context->key_offset;
+    switch (context->key_size)
+    {
+    case 1:
+        return *key;
+    case 2:
+    {
+        ZyanU16 value;
+        ZYAN_MEMCPY(&value, key, sizeof(value));
+        return value;
+    }
+    case 4:
+    {
+        ZyanU32 value;
+        ZYAN_MEMCPY(&value, key, sizeof(value));
+        return value;
+    }
+    case 8:
+    {
+        ZyanU64 value;
+        ZYAN_MEMCPY(&value, key, sizeof(value));
+        return value;
+    }
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/**
+ * Compares two elements using the comparison callback or the integer key of the sort context.
+ *
+ * @param   context A pointer to the `ZyanVectorSortContext` struct.
+ * @param   left    A pointer to the first element.
+ * @param   right   A pointer to the second element.
+ *
+ * @return  The comparison result (see `ZyanComparison`).
+ */
+static ZyanI32 ZyanVectorSortCompare(const ZyanVectorSortContext* context, const void* left,
+    const void* right)
+{
+    ZYAN_ASSERT(context);
+
+    if (context->comparison)
+    {
+        return context->comparison(left, right);
+    }
+
+    const ZyanU64 a = ZyanVectorSortReadKey(context, left);
+    const ZyanU64 b = ZyanVectorSortReadKey(context, right);
+    return (a > b) - (a < b);
+}
+
+/**
+ * Swaps two elements.
+ *
+ * @param   left    A pointer to the first element.
+ * @param   right   A pointer to the second element.
+ * @param   size    The size of a single element in bytes.
+ */
+static void ZyanVectorSortSwap(void* left, void* right, ZyanUSize size)
+{
+    ZYAN_ASSERT(left);
+    ZYAN_ASSERT(right);
+
+    ZyanU8* a = (ZyanU8*)left;
+    ZyanU8* b = (ZyanU8*)right;
+    for (; size >= sizeof(ZyanU64); size -= sizeof(ZyanU64))
+    {
+        ZyanU64 t;
+        ZYAN_MEMCPY(&t, a, sizeof(ZyanU64));
+        ZYAN_MEMCPY(a, b, sizeof(ZyanU64));
+        ZYAN_MEMCPY(b, &t, sizeof(ZyanU64));
+        a += sizeof(ZyanU64);
+        b += sizeof(ZyanU64);
+    }
+    for (; size > 0; --size)
+    {
+        const ZyanU8 t = *a;
+        *a++ = *b;
+        *b++ = t;
+    }
+}
+
+/**
+ * Sorts the given range using insertion sort.
+ *
+ * @param   context A pointer to the `ZyanVectorSortContext` struct.
+ * @param   base    A pointer to the first element of the range.
+ * @param   n       The number of elements in the range.
+ *
+ * Insertion sort is stable and the fastest option for small ranges.
+ */
+static void ZyanVectorInsertionSort(const ZyanVectorSortContext* context, ZyanU8* base,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(context);
+
+    const ZyanUSize size = context->element_size;
+    for (ZyanUSize i = 1; i < n; ++i)
+    {
+        for (ZyanUSize j = i; (j > 0) && (ZyanVectorSortCompare(context,
+            ZYCORE_VECTOR_SORT_ELEMENT(base, j - 1, size),
+            ZYCORE_VECTOR_SORT_ELEMENT(base, j, size)) > 0); --j)
+        {
+            ZyanVectorSortSwap(ZYCORE_VECTOR_SORT_ELEMENT(base, j - 1, size),
+                ZYCORE_VECTOR_SORT_ELEMENT(base, j, size), size);
+        }
+    }
+}
+
+/**
+ * Moves the element at `root` down the heap, until the heap property is restored.
+ *
+ * @param   context A pointer to the `ZyanVectorSortContext` struct.
+ * @param   base    A pointer to the first element of the heap.
+ * @param   root    The index of the element to move.
+ * @param   n       The number of elements in the heap.
+ */
+static void ZyanVectorSortSiftDown(const ZyanVectorSortContext* context, ZyanU8* base,
+    ZyanUSize root, ZyanUSize n)
+{
+    ZYAN_ASSERT(context);
+
+    const ZyanUSize size = context->element_size;
+    for (ZyanUSize child = 2 * root + 1; child < n; child = 2 * root + 1)
+    {
+        if ((child + 1 < n) && (ZyanVectorSortCompare(context,
+            ZYCORE_VECTOR_SORT_ELEMENT(base, child, size),
+            ZYCORE_VECTOR_SORT_ELEMENT(base, child + 1, size)) < 0))
+        {
+            ++child;
+        }
+        if (ZyanVectorSortCompare(context, ZYCORE_VECTOR_SORT_ELEMENT(base, root, size),
+            ZYCORE_VECTOR_SORT_ELEMENT(base, child, size)) >= 0)
+        {
+            break;
+        }
+        ZyanVectorSortSwap(ZYCORE_VECTOR_SORT_ELEMENT(base, root, size),
+            ZYCORE_VECTOR_SORT_ELEMENT(base, child, size), size);
+        root = child;
+    }
+}
+
+/**
+ * Sorts the given range using heapsort.
+ *
+ * @param   context A pointer to the `ZyanVectorSortContext` struct.
+ * @param   base    A pointer to the first element of the range.
+ * @param   n       The number of elements in the range.
+ *
+ * Heapsort guarantees `O(n log n)` and is used as fallback, if the partitioning keeps failing.
+ */
+static void ZyanVectorHeapSort(const ZyanVectorSortContext* context, ZyanU8* base, ZyanUSize n)
+{
+    ZYAN_ASSERT(context);
+
+    const ZyanUSize size = context->element_size;
+    for (ZyanUSize i = n / 2; i-- > 0;)
+    {
+        ZyanVectorSortSiftDown(context, base, i, n);
+    }
+    for (ZyanUSize i = n; i-- > 1;)
+    {
+        ZyanVectorSortSwap(base, ZYCORE_VECTOR_SORT_ELEMENT(base, i, size), size);
+        ZyanVectorSortSiftDown(context, base, 0, i);
+    }
+}
+
+/**
+ * Sorts three elements.
+ *
+ * @param   context A pointer to the `ZyanVectorSortContext` struct.
+ * @param   a       A pointer to the first element.
+ * @param   b       A pointer to the second element.
+ * @param   c       A pointer to the third element.
+ *
+ * After the call, `a` contains the smallest and `c` the largest element.
+ */
+static void ZyanVectorSortThree(const ZyanVectorSortContext* context, ZyanU8* a, ZyanU8* b,
+    ZyanU8* c)
+{
+    ZYAN_ASSERT(context);
+
+    const ZyanUSize size = context->element_size;
+    if (ZyanVectorSortCompare(context, b, a) < 0)
+    {
+        ZyanVectorSortSwap(a, b, size);
+    }
+    if (ZyanVectorSortCompare(context, c, b) < 0)
+    {
+        ZyanVectorSortSwap(b, c, size);
+        if (ZyanVectorSortCompare(context, b, a) < 0)
+        {
+            ZyanVectorSortSwap(a, b, size);
+        }
+    }
+}
+
+/**
+ * Partitions the given range around its first element.
+ *
+ * @param   context A pointer to the `ZyanVectorSortContext` struct.
+ * @param   base    A pointer to the first element of the range, which is used as pivot.
+ * @param   n       The number of elements in the range.
+ *
+ * @return  The final index of the pivot element.
+ *
+ * Both scans stop at elements equal to the pivot, which keeps the partitions balanced for
+ * ranges with many duplicates.
+ */
+static ZyanUSize ZyanVectorSortPartition(const ZyanVectorSortContext* context, ZyanU8* base,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(context);
+    ZYAN_ASSERT(n >= 2);
+
+    const ZyanUSize size = context->element_size;
+    ZyanUSize i = 0;
+    ZyanUSize j = n;
+    for (;;)
+    {
+        while ((++i < n - 1) &&
+            (ZyanVectorSortCompare(context, ZYCORE_VECTOR_SORT_ELEMENT(base, i, size), base) < 0));
+        while ((--j > 0) &&
+            (ZyanVectorSortCompare(context, base, ZYCORE_VECTOR_SORT_ELEMENT(base, j, size)) < 0));
+        if (i >= j)
+        {
+            break;
+        }
+        ZyanVectorSortSwap(ZYCORE_VECTOR_SORT_ELEMENT(base, i, size),
+            ZYCORE_VECTOR_SORT_ELEMENT(base, j, size), size);
+    }
+    ZyanVectorSortSwap(base, ZYCORE_VECTOR_SORT_ELEMENT(base, j, size), size);
+
+    return j;
+}
+
+/**
+ * Swaps a few elements of a partition to break up patterns that caused an unbalanced split.
+ *
+ * @param   context A pointer to the `ZyanVectorSortContext` struct.
+ * @param   base    A pointer to the first element of the partition.
+ * @param   n       The number of elements in the partition.
+ */
+static void ZyanVectorSortBreakPatterns(const ZyanVectorSortContext* context, ZyanU8* base,
+    ZyanUSize n)
+{
+    ZYAN_ASSERT(context);
+
+    if (n < ZYCORE_VECTOR_SORT_INSERTION_THRESHOLD)
+    {
+        return;
+    }
+
+    const ZyanUSize size = context->element_size;
+    const ZyanUSize quarter = n / 4;
+    ZyanVectorSortSwap(base, ZYCORE_VECTOR_SORT_ELEMENT(base, quarter, size), size);
+    ZyanVectorSortSwap(ZYCORE_VECTOR_SORT_ELEMENT(base, n - 1, size),
+        ZYCORE_VECTOR_SORT_ELEMENT(base, n - quarter, size), size);
+    if (n > ZYCORE_VECTOR_SORT_NINTHER_THRESHOLD)
+    {
+        ZyanVectorSortSwap(ZYCORE_VECTOR_SORT_ELEMENT(base, 1, size),
+            ZYCORE_VECTOR_SORT_ELEMENT(base, quarter + 1, size), size);
+        ZyanVectorSortSwap(ZYCORE_VECTOR_SORT_ELEMENT(base, 2, size),
+            ZYCORE_VECTOR_SORT_ELEMENT(base, quarter + 2, size), size);
+        ZyanVectorSortSwap(ZYCORE_VECTOR_SORT_ELEMENT(base, n - 2, size),
+            ZYCORE_VECTOR_SORT_ELEMENT(base, n - quarter - 1, size), size);
+        ZyanVectorSortSwap(ZYCORE_VECTOR_SORT_ELEMENT(base, n - 3, size),
+            ZYCORE_VECTOR_SORT_ELEMENT(base, n - quarter - 2, size), size);
+    }
+}
+
+/**
+ * Sorts the given range using a pattern-defeating introsort.
+ *
+ * @param   context     A pointer to the `ZyanVectorSortContext` struct.
+ * @param   base        A pointer to the first element of the range.
+ * @param   n           The number of elements in the range.
+ * @param   bad_allowed The number of unbalanced partitions allowed, before falling back to
+ *                      heapsort.
+ *
+ * The pivot is the median of three elements, or the pseudo-median of nine elements for large
+ * ranges. After an unbalanced partition, a few elements are swapped to break up the pattern
+ * that caused it. Recursion only happens on the smaller partition, which limits the stack depth
+ * to `O(log n)`.
+ */
+static void ZyanVectorIntroSort(const ZyanVectorSortContext* context, ZyanU8* base, ZyanUSize n,
+    ZyanUSize bad_allowed)
+{
+    ZYAN_ASSERT(context);
+
+    const ZyanUSize size = context->element_size;
+    while (n > ZYCORE_VECTOR_SORT_INSERTION_THRESHOLD)
+    {
+        // Move the pivot to the first element of the range
+        const ZyanUSize half = n / 2;
+        ZyanU8* const middle = ZYCORE_VECTOR_SORT_ELEMENT(base, half, size);
+        ZyanU8* const last = ZYCORE_VECTOR_SORT_ELEMENT(base, n - 1, size);
+        if (n > ZYCORE_VECTOR_SORT_NINTHER_THRESHOLD)
+        {
+            ZyanVectorSortThree(context, base, middle, last);
+            ZyanVectorSortThree(context, base + size, middle - size, last - size);
+            ZyanVectorSortThree(context, base + 2 * size, middle + size, last - 2 * size);
+            ZyanVectorSortThree(context, middle - size, middle, middle + size);
+            ZyanVectorSortSwap(base, middle, size);
+        } else
+        {
+            ZyanVectorSortThree(context, middle, base, last);
+        }
+
+        const ZyanUSize pivot = ZyanVectorSortPartition(context, base, n);
+        ZyanU8* const right = ZYCORE_VECTOR_SORT_ELEMENT(base, pivot + 1, size);
+        const ZyanUSize left_size = pivot;
+        const ZyanUSize right_size = n - pivot - 1;
+
+        if ((left_size < n / 8) || (right_size < n / 8))
+        {
+            if (--bad_allowed == 0)
+            {
+                ZyanVectorHeapSort(context, base, n);
+                return;
+            }
+            ZyanVectorSortBreakPatterns(context, base, left_size);
+            ZyanVectorSortBreakPatterns(context, right, right_size);
+        }
+
+        if (left_size < right_size)
+        {
+            ZyanVectorIntroSort(context, base, left_size, bad_allowed);
+            base = right;
+            n = right_size;
+        } else
+        {
+            ZyanVectorIntroSort(context, right, right_size, bad_allowed);
+            n = left_size;
+        }
+    }
+
+    ZyanVectorInsertionSort(context, base, n);
+}
+
+/**
+ * Sorts the given range in-place.
+ *
+ * @param   context A pointer to the `ZyanVectorSortContext` struct.
+ * @param   base    A pointer to the first element of the range.
+ * @param   n       The number of elements in the range.
+ */
+static void ZyanVectorSortInPlace(const ZyanVectorSortContext* context, ZyanU8* base,
+    ZyanUSize n)
+{
+    // Allow `log2(n)` unbalanced partitions before falling back to heapsort
+    ZyanUSize bad_allowed = 0;
+    for (ZyanUSize i = n; i > 1; i >>= 1)
+    {
+        ++bad_allowed;
+    }
+
+    ZyanVectorIntroSort(context, base, n, bad_allowed);
+}
+
+/**
+ * Sorts the given range by the integer key of the sort context using LSD radix sort.
+ *
+ * @param   context A pointer to the `ZyanVectorSortContext` struct.
+ * @param   base    A pointer to the first element of the range.
+ * @param   scratch A pointer to a scratch buffer with room for `n` elements.
+ * @param   n       The number of elements in the range.
+ *
+ * Radix sort is stable. Passes for key bytes that are equal for all elements are skipped.
+ */
+static void ZyanVectorRadixSort(const ZyanVectorSortContext* context, ZyanU8* base,
+    ZyanU8* scratch, ZyanUSize n)
+{
+    ZYAN_ASSERT(context);
+    ZYAN_ASSERT(n);
+
+    const ZyanUSize size = context->element_size;
+    ZyanU8* source = base;
+    ZyanU8* destination = scratch;
+    ZyanUSize offsets[256];
+    for (ZyanUSize shift = 0; shift < context->key_size * 8; shift += 8)
+    {
+        ZYAN_MEMSET(offsets, 0, sizeof(offsets));
+        for (ZyanUSize i = 0; i < n; ++i)
+        {
+            const ZyanU64 key =
+                ZyanVectorSortReadKey(context, ZYCORE_VECTOR_SORT_ELEMENT(source, i, size));
+            ++offsets[(key >> shift) & 0xFF];
+        }
+        const ZyanU64 first = ZyanVectorSortReadKey(context, source);
+        if (offsets[(first >> shift) & 0xFF] == n)
+        {
+            continue;
+        }
+
+        ZyanUSize offset = 0;
+        for (ZyanUSize i = 0; i < ZYAN_ARRAY_LENGTH(offsets); ++i)
+        {
+            const ZyanUSize count = offsets[i];
+            offsets[i] = offset;
+            offset += count;
+        }
+        for (ZyanUSize i = 0; i < n; ++i)
+        {
+            const ZyanU8* const element = ZYCORE_VECTOR_SORT_ELEMENT(source, i, size);
+            const ZyanU64 key = ZyanVectorSortReadKey(context, element);
+            ZYAN_MEMCPY(ZYCORE_VECTOR_SORT_ELEMENT(destination, offsets[(key >> shift) & 0xFF]++,
+                size), element, size);
+        }
+
+        ZyanU8* const t = source;
+        source = destination;
+        destination = t;
+    }
+
+    if (source != base)
+    {
+        ZYAN_MEMCPY(base, source, n * size);
+    }
+}
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Returns the number of elements taken from the first range among the first `k` elements of the
+ * stable merge of two sorted ranges.
+ *
+ * @param   context A pointer to the `ZyanVectorSortContext` struct.
+ * @param   a       A pointer to the first element of the first range.
+ * @param   a_size  The number of elements in the first range.
+ * @param   b       A pointer to the first element of the second range.
+ * @param   b_size  The number of elements in the second range.
+ * @param   k       The number of merged elements.
+ *
+ * @return  The number of elements taken from the first range.
+ *
+ * This allows multiple threads to merge independent parts of the same output without
+ * synchronization.
+ */
+static ZyanUSize ZyanVectorSortCorank(const ZyanVectorSortContext* context, const ZyanU8* a,
+    ZyanUSize a_size, const ZyanU8* b, ZyanUSize b_size, ZyanUSize k)
+{
+    ZYAN_ASSERT(context);
+    ZYAN_ASSERT(k <= a_size + b_size);
+
+    // Search the largest `i`, so that all of `a[0..i)` are merged before `b[k - i]`
+    const ZyanUSize size = context->element_size;
+    ZyanUSize lo = (k > b_size) ? k - b_size : 0;
+    ZyanUSize hi = ZYAN_MIN(k, a_size);
+    while (lo < hi)
+    {
+        const ZyanUSize i = lo + (hi - lo + 1) / 2;
+        if (ZyanVectorSortCompare(context, ZYCORE_VECTOR_SORT_ELEMENT(a, i - 1, size),
+            ZYCORE_VECTOR_SORT_ELEMENT(b, k - i, size)) <= 0)
+        {
+            lo = i;
+        } else
+        {
+            hi = i - 1;
+        }
+    }
+
+    return lo;
+}
+
+/**
+ * Merges two sorted ranges.
+ *
+ * @param   context     A pointer to the `ZyanVectorSortContext` struct.
+ * @param   a           A pointer to the first element of the first range.
+ * @param   a_size      The number of elements in the first range.
+ * @param   b           A pointer to the first element of the second range.
+ * @param   b_size      The number of elements in the second range.
+ * @param   destination A pointer to the destination buffer.
+ *
+ * Equal elements are taken from the first range first.
+ */
+static void ZyanVectorSortMerge(const ZyanVectorSortContext* context, const ZyanU8* a,
+    ZyanUSize a_size, const ZyanU8* b, ZyanUSize b_size, ZyanU8* destination)
+{
+    ZYAN_ASSERT(context);
+
+    const ZyanUSize size = context->element_size;
+    const ZyanU8* const a_end = ZYCORE_VECTOR_SORT_ELEMENT(a, a_size, size);
+    const ZyanU8* const b_end = ZYCORE_VECTOR_SORT_ELEMENT(b, b_size, size);
+    while ((a != a_end) && (b != b_end))
+    {
+        if (ZyanVectorSortCompare(context, b, a) < 0)
+        {
+            ZYAN_MEMCPY(destination, b, size);
+            b += size;
+        } else
+        {
+            ZYAN_MEMCPY(destination, a, size);
+            a += size;
+        }
+        destination += size;
+    }
+    ZYAN_MEMCPY(destination, a, (ZyanUSize)(a_end - a));
+    destination += a_end - a;
+    ZYAN_MEMCPY(destination, b, (ZyanUSize)(b_end - b));
+}
+
+/**
+ * Executes a single `ZyanVectorSortTask`.
+ *
+ * @param   argument    A pointer to the `ZyanVectorSortTask` struct.
+ */
+static void ZyanVectorSortWorker(void* argument)
+{
+    ZYAN_ASSERT(argument);
+
+    const ZyanVectorSortTask* const task = (const ZyanVectorSortTask*)argument;
+    const ZyanVectorSortContext* const context = task->context;
+    const ZyanUSize size = context->element_size;
+
+    if (!task->run_count)
+    {
+        ZyanU8* const run = ZYCORE_VECTOR_SORT_ELEMENT(task->source, task->begin, size);
+        ZyanVectorSortInPlace(context, run, task->end - task->begin);
+        if (task->destination)
+        {
+            ZYAN_MEMCPY(ZYCORE_VECTOR_SORT_ELEMENT(task->destination, task->begin, size), run,
+                (task->end - task->begin) * size);
+        }
+        return;
+    }
+
+    for (ZyanUSize i = 0; i < task->run_count; i += 2)
+    {
+        // An odd run at the end is merged with an empty run, which copies it
+        const ZyanUSize a_begin = task->bounds[i];
+        const ZyanUSize b_begin = task->bounds[ZYAN_MIN(i + 1, task->run_count)];
+        const ZyanUSize b_end = task->bounds[ZYAN_MIN(i + 2, task->run_count)];
+        const ZyanUSize begin = ZYAN_MAX(a_begin, task->begin);
+        const ZyanUSize end = ZYAN_MIN(b_end, task->end);
+        if (begin >= end)
+        {
+            continue;
+        }
+
+        const ZyanU8* const a = ZYCORE_VECTOR_SORT_ELEMENT(task->source, a_begin, size);
+        const ZyanU8* const b = ZYCORE_VECTOR_SORT_ELEMENT(task->source, b_begin, size);
+        const ZyanUSize a_size = b_begin - a_begin;
+        const ZyanUSize b_size = b_end - b_begin;
+        const ZyanUSize a_first = ZyanVectorSortCorank(context, a, a_size, b, b_size,
+            begin - a_begin);
+        const ZyanUSize a_last = ZyanVectorSortCorank(context, a, a_size, b, b_size,
+            end - a_begin);
+        const ZyanUSize b_first = begin - a_begin - a_first;
+        const ZyanUSize b_last = end - a_begin - a_last;
+
+        ZyanVectorSortMerge(context, ZYCORE_VECTOR_SORT_ELEMENT(a, a_first, size),
+            a_last - a_first, ZYCORE_VECTOR_SORT_ELEMENT(b, b_first, size), b_last - b_first,
+            ZYCORE_VECTOR_SORT_ELEMENT(task->destination, begin, size));
+    }
+}
+
+/**
+ * Executes the given tasks in parallel and waits for all of them to finish.
+ *
+ * @param   tasks   A pointer to the `ZyanVectorSortTask` array.
+ * @param   count   The number of tasks.
+ *
+ * The last task is executed on the calling thread. Tasks for which no thread could be created
+ * are executed on the calling thread as well.
+ */
+static void ZyanVectorSortRunTasks(ZyanVectorSortTask* tasks, ZyanUSize count)
+{
+    ZYAN_ASSERT(tasks);
+    ZYAN_ASSERT(count);
+    ZYAN_ASSERT(count <= ZYCORE_VECTOR_SORT_MAX_THREADS);
+
+    ZyanThread threads[ZYCORE_VECTOR_SORT_MAX_THREADS];
+    ZyanBool started[ZYCORE_VECTOR_SORT_MAX_THREADS];
+    for (ZyanUSize i = 0; i < count - 1; ++i)
+    {
+        started[i] = ZYAN_SUCCESS(ZyanThreadCreate(&threads[i], &ZyanVectorSortWorker,
+            &tasks[i]));
+    }
+    ZyanVectorSortWorker(&tasks[count - 1]);
+    for (ZyanUSize i = 0; i < count - 1; ++i)
+    {
+        if (!started[i])
+        {
+            ZyanVectorSortWorker(&tasks[i]);
+            continue;
+        }
+        ZYAN_UNUSED(ZyanThreadJoin(threads[i]));
+    }
+}
+
+#endif // ZYAN_NO_LIBC
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Searching                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Sequentially searches for the first element that is bitwise equal to `element`.
+ *
+ * @param   data    A pointer to the first element.
+ * @param   count   The number of elements.
+ * @param   element A pointer to the element to search for.
+ * @param   size    The element size.
+ *
+ * @return  The index of the found element or `count`, if the element was not found.
+ */
+static ZyanUSize ZyanVectorFindBytesScalar(const ZyanU8* data, ZyanUSize count,
+    const void* element, ZyanUSize size)
+{
+    ZYAN_ASSERT(data);
+    ZYAN_ASSERT(element);
+
+#define ZYCORE_VECTOR_FIND_TYPED(type) \
+    { \
+        type needle; \
+        ZYAN_MEMCPY(&needle, element, sizeof(type)); \
+        for (ZyanUSize i = 0; i < count; ++i) \
+        { \
+            type value; \
+            ZYAN_MEMCPY(&value, data + i * sizeof(type), sizeof(type)); \
+            if (value == needle) \
+            { \
+                return i; \
+            } \
+        } \
+        return count; \
+    }
+
+    switch (size)
+    {
+    case 1:
+    {
+        const ZyanU8* const found = (const ZyanU8*)ZYAN_MEMCHR(data, *(const ZyanU8*)element,
+            count);
+        return found ? (ZyanUSize)(found - data) : count;
+    }
+    case 2:
+        ZYCORE_VECTOR_FIND_TYPED(ZyanU16)
+    case 4:
+        ZYCORE_VECTOR_FIND_TYPED(ZyanU32)
+    case 8:
+        ZYCORE_VECTOR_FIND_TYPED(ZyanU64)
+    default:
+        for (ZyanUSize i = 0; i < count; ++i)
+        {
+            if (!ZYAN_MEMCMP(data + i * size, element, size))
+            {
+                return i;
+            }
+        }
+        return count;
+    }
+
+#undef ZYCORE_VECTOR_FIND_TYPED
+}
+
+#if defined(ZYCORE_VECTOR_FIND_SIMD)
+
+/**
+ * Defines the instruction set extensions available to `ZyanVectorFindBytes`.
+ */
+typedef enum ZyanVectorSimdLevel_
+{
+    ZYAN_VECTOR_SIMD_LEVEL_NONE,
+    ZYAN_VECTOR_SIMD_LEVEL_SSE2,
+    ZYAN_VECTOR_SIMD_LEVEL_AVX2
+} ZyanVectorSimdLevel;
+
+/**
+ * Detects the instruction set extensions supported by the current processor.
+ *
+ * @return  The best supported `ZyanVectorSimdLevel`.
+ */
+#if defined(ZYAN_MSVC)
+ZYCORE_VECTOR_TARGET("xsave")
+#endif
+static ZyanVectorSimdLevel ZyanVectorGetSimdLevel(void)
+{
+    // Racing threads store the same value, so a lost update is harmless
+    static ZyanU32 volatile cached = 0;
+    const ZyanU32 value = cached;
+    if (value)
+    {
+        return (ZyanVectorSimdLevel)(value - 1);
+    }
+
+    ZyanVectorSimdLevel level = ZYAN_VECTOR_SIMD_LEVEL_NONE;
+#if defined(ZYAN_MSVC)
+    int info[4];
+    __cpuid(info, 0);
+    const int max_leaf = info[0];
+    __cpuid(info, 1);
+    if (info[3] & (1 << 26))
+    {
+        level = ZYAN_VECTOR_SIMD_LEVEL_SSE2;
+    }
+    // AVX2 additionally requires the OS to preserve the YMM registers (`OSXSAVE` and `XCR0`)
+    const ZyanBool os_avx = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) &&
+        ((_xgetbv(0) & 0x06) == 0x06);
+    if (os_avx && (max_leaf >= 7))
+    {
+        __cpuidex(info, 7, 0);
+        if (info[1] & (1 << 5))
+        {
+            level = ZYAN_VECTOR_SIMD_LEVEL_AVX2;
+        }
+    }
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        level = ZYAN_VECTOR_SIMD_LEVEL_AVX2;
+    } else
+    if (__builtin_cpu_supports("sse2"))
+    {
+        level = ZYAN_VECTOR_SIMD_LEVEL_SSE2;
+    }
+#endif
+
+    cached = (ZyanU32)level + 1;
+    return level;
+}
+
+/**
+ * Reduces a byte-wise equality mask to one bit for each fully matching element.
+ *
+ * @param   mask    The byte-wise equality mask.
+ * @param   size    The element size (1, 2, 4 or 8).
+ *
+ * @return  A mask, that has the lowest bit of each matching element set.
+ */
+static ZyanU32 ZyanVectorFindBytesReduceMask(ZyanU32 mask, ZyanUSize size)
+{
+    switch (size)
+    {
+    case 1:
+        return mask;
+    case 2:
+        return mask & (mask >> 1) & 0x55555555;
+    case 4:
+        mask &= mask >> 1;
+        return mask & (mask >> 2) & 0x11111111;
+    case 8:
+        mask &= mask >> 1;
+        mask &= mask >> 2;
+        return mask & (mask >> 4) & 0x01010101;
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/**
+ * Fills a buffer of `length` bytes with copies of `element`.
+ *
+ * @param   buffer  A pointer to the buffer.
+ * @param   length  The length of the buffer.
+ * @param   element A pointer to the element.
+ * @param   size    The element size.
+ */
+static void ZyanVectorFindBytesBroadcast(ZyanU8* buffer, ZyanUSize length, const void* element,
+    ZyanUSize size)
+{
+    for (ZyanUSize i = 0; i < length; i += size)
+    {
+        ZYAN_MEMCPY(buffer + i, element, size);
+    }
+}
+
+/**
+ * Searches the 16 byte blocks of the given elements for `element` using SSE2.
+ *
+ * @param   data    A pointer to the first element.
+ * @param   count   The number of elements.
+ * @param   element A pointer to the element to search for.
+ * @param   size    The element size (1, 2, 4 or 8).
+ *
+ * @return  The index of the found element or the number of elements searched without a match.
+ *          Remaining elements that do not fill a whole block are left to the caller.
+ */
+ZYCORE_VECTOR_TARGET("sse2")
+static ZyanUSize ZyanVectorFindBytesSSE2(const ZyanU8* data, ZyanUSize count,
+    const void* element, ZyanUSize size)
+{
+    ZyanU8 pattern[16];
+    ZyanVectorFindBytesBroadcast(pattern, sizeof(pattern), element, size);
+    const __m128i needle = _mm_loadu_si128((const __m128i*)pattern);
+
+    const ZyanUSize lanes = sizeof(pattern) / size;
+    ZyanUSize i = 0;
+    for (; i + lanes <= count; i += lanes)
+    {
+        const __m128i block = _mm_loadu_si128((const __m128i*)(data + i * size));
+        const ZyanU32 mask = ZyanVectorFindBytesReduceMask(
+            (ZyanU32)_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)), size);
+        if (mask)
+        {
+            return i + ZyanBitScanForward32(mask) / size;
+        }
+    }
+
+    return i;
+}
+
+/**
+ * Searches the 32 byte blocks of the given elements for `element` using AVX2.
+ *
+ * @param   data    A pointer to the first element.
+ * @param   count   The number of elements.
+ * @param   element A pointer to the element to search for.
+ * @param   size    The element size (1, 2, 4 or 8).
+ *
+ * @return  The index of the found element or the number of elements searched without a match.
+ *          Remaining elements that do not fill a whole block are left to the caller.
+ */
+ZYCORE_VECTOR_TARGET("avx2")
+static ZyanUSize ZyanVectorFindBytesAVX2(const ZyanU8* data, ZyanUSize count,
+    const void* element, ZyanUSize size)
+{
+    ZyanU8 pattern[32];
+    ZyanVectorFindBytesBroadcast(pattern, sizeof(pattern), element, size);
+    const __m256i needle = _mm256_loadu_si256((const __m256i*)pattern);
+
+    const ZyanUSize lanes = sizeof(pattern) / size;
+    ZyanUSize i = 0;
+    for (; i + lanes <= count; i += lanes)
+    {
+        const __m256i block = _mm256_loadu_si256((const __m256i*)(data + i * size));
+        const ZyanU32 mask = ZyanVectorFindBytesReduceMask(
+            (ZyanU32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)), size);
+        if (mask)
+        {
+            return i + ZyanBitScanForward32(mask) / size;
+        }
+    }
+
+    return i;
+}
+
+#endif // ZYCORE_VECTOR_FIND_SIMD
+
+/**
+ * Returns the index of the first element in the given range that is not less than `element`,
+ * using a branchless binary-search algorithm.
  *
- * @param   vector  A pointer to the `ZyanVector` instance.
- * @param   index   The start index.
- * @param   count   The amount of shift operations.
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   element     A pointer to the element to search for.
+ * @param   comparison  The comparison function to use.
+ * @param   index       The start index.
+ * @param   count       The number of elements in the range.
  *
- * @return  A zyan status code.
+ * @return  The index of the first element not less than `element` or `index + count`, if there
+ *          is no such element.
  */
-static ZyanStatus ZyanVectorShiftRight(ZyanVector* vector, ZyanUSize index, ZyanUSize count)
+static ZyanUSize ZyanVectorLowerBound(const ZyanVector* vector, const void* element,
+    ZyanComparison comparison, ZyanUSize index, ZyanUSize count)
 {
     ZYAN_ASSERT(vector);
-    ZYAN_ASSERT(vector->element_size);
-    ZYAN_ASSERT(vector->data);
-    ZYAN_ASSERT(count > 0);
-    ZYAN_ASSERT(vector->size + count <= vector->capacity);
+    ZYAN_ASSERT(index + count <= vector->size);
 
-    const void* const source = ZYCORE_VECTOR_OFFSET(vector, index);
-    void* const dest         = ZYCORE_VECTOR_OFFSET(vector, index + count);
-    const ZyanUSize size     = (vector->size - index) * vector->element_size;
-    ZYAN_MEMMOVE(dest, source, size);
+    if (!count)
+    {
+        return index;
+    }
 
-    return ZYAN_STATUS_SUCCESS;
-}
+    const ZyanUSize size = vector->element_size;
+    const ZyanU8* const first = (const ZyanU8*)ZYCORE_VECTOR_OFFSET(vector, index);
+    const ZyanU8* base = first;
+    ZyanUSize n = count;
+    while (n > 1)
+    {
+        const ZyanUSize half = n / 2;
+        // Fetch both candidate midpoints of the next iteration, while the comparison is pending
+        ZYCORE_VECTOR_PREFETCH(base + (half / 2) * size);
+        ZYCORE_VECTOR_PREFETCH(base + (half + half / 2) * size);
+        base = (comparison(base + half * size, element) < 0) ? base + half * size : base;
+        n -= half;
+    }
 
-/* ---------------------------------------------------------------------------------------------- */
+    const ZyanUSize result = index + (ZyanUSize)(base - first) / size;
+    return (comparison(base, element) < 0) ? result + 1 : result;
+}
 
 /* ============================================================================================== */
 /* Exported functions                                                                             */
@@ -187,6 +1511,19 @@ ZyanStatus ZyanVectorInit(ZyanVector* vector, ZyanUSize element_size, ZyanUSize
         ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR, ZYAN_VECTOR_DEFAULT_SHRINK_THRESHOLD);
 }
 
+ZyanStatus ZyanVectorInitAligned(ZyanVector* vector, ZyanUSize element_size, ZyanUSize capacity,
+    ZyanMemberProcedure destructor, ZyanUSize alignment)
+{
+    ZyanAllocator* const allocator = ZyanAllocatorDefaultAligned(alignment);
+    if (!allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorInitEx(vector, element_size, capacity, destructor, allocator,
+        ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR, ZYAN_VECTOR_DEFAULT_SHRINK_THRESHOLD);
+}
+
 #endif // ZYAN_NO_LIBC
 
 ZyanStatus ZyanVectorInitEx(ZyanVector* vector, ZyanUSize element_size, ZyanUSize capacity,
@@ -208,6 +1545,8 @@ ZyanStatus ZyanVectorInitEx(ZyanVector* vector, ZyanUSize element_size, ZyanUSiz
     vector->element_size     = element_size;
     vector->destructor       = destructor;
     vector->data             = ZYAN_NULL;
+    vector->growth_policy    = ZYAN_NULL;
+    vector->shrink_pending   = 0;
 
     return allocator->allocate(vector->allocator, &vector->data, vector->element_size,
         vector->capacity);
@@ -229,6 +1568,89 @@ ZyanStatus ZyanVectorInitCustomBuffer(ZyanVector* vector, ZyanUSize element_size
     vector->element_size     = element_size;
     vector->destructor       = destructor;
     vector->data             = buffer;
+    vector->growth_policy    = ZYAN_NULL;
+    vector->shrink_pending   = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanVectorInitVirtual(ZyanVector* vector, ZyanUSize element_size,
+    ZyanUSize max_capacity, ZyanMemberProcedure destructor)
+{
+    if (!vector || !element_size || !max_capacity)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize granularity =
+        ZYAN_MAX(ZyanMemoryGetSystemPageSize(), ZYCORE_VECTOR_VIRTUAL_COMMIT_STEP);
+    if (max_capacity > ((ZyanUSize)-1 - ZYCORE_VECTOR_VIRTUAL_HEADER_SIZE - granularity) /
+        element_size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize reserved = ZYAN_ALIGN_UP(
+        ZYCORE_VECTOR_VIRTUAL_HEADER_SIZE + element_size * max_capacity, granularity);
+    const ZyanUSize committed = ZYAN_ALIGN_UP(
+        ZYCORE_VECTOR_VIRTUAL_HEADER_SIZE + element_size * ZYAN_VECTOR_MIN_CAPACITY, granularity);
+
+    void* base;
+    ZYAN_CHECK(ZyanMemoryVirtualReserve(&base, reserved));
+    const ZyanStatus status = ZyanMemoryVirtualCommit(base, committed, ZYAN_PAGE_READWRITE);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanMemoryVirtualFree(base, reserved);
+        return status;
+    }
+
+    ZyanVectorVirtualHeader* const header = (ZyanVectorVirtualHeader*)base;
+    header->reserved     = reserved;
+    header->committed    = committed;
+    header->granularity  = granularity;
+    header->max_capacity = max_capacity;
+
+    vector->allocator        = &ZyanVectorVirtualAllocator;
+    vector->growth_factor    = 1;
+    vector->shrink_threshold = 0;
+    vector->size             = 0;
+    vector->capacity         =
+        ZYAN_MIN(max_capacity, (committed - ZYCORE_VECTOR_VIRTUAL_HEADER_SIZE) / element_size);
+    vector->element_size     = element_size;
+    vector->destructor       = destructor;
+    vector->data             = (ZyanU8*)base + ZYCORE_VECTOR_VIRTUAL_HEADER_SIZE;
+    vector->growth_policy    = ZYAN_NULL;
+    vector->shrink_pending   = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanVectorInitSmall(ZyanSmallVector* vector, ZyanUSize element_size, void* buffer,
+    ZyanUSize capacity, ZyanMemberProcedure destructor)
+{
+    return ZyanVectorInitSmallEx(vector, element_size, buffer, capacity, destructor,
+        ZyanAllocatorDefault(), ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR,
+        ZYAN_VECTOR_DEFAULT_SHRINK_THRESHOLD);
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanVectorInitSmallEx(ZyanSmallVector* vector, ZyanUSize element_size, void* buffer,
+    ZyanUSize capacity, ZyanMemberProcedure destructor, ZyanAllocator* allocator,
+    ZyanU8 growth_factor, ZyanU8 shrink_threshold)
+{
+    if (!vector || !element_size || !buffer || !capacity)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanSmallBufferAllocatorInit(&vector->allocator, buffer, element_size * capacity,
+        allocator));
+    ZYAN_CHECK(ZyanVectorInitEx(&vector->vector, element_size, capacity, destructor,
+        &vector->allocator.allocator, growth_factor, shrink_threshold));
+    ZYAN_ASSERT(vector->vector.data == buffer);
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -432,7 +1854,7 @@ ZyanStatus ZyanVectorPushBack(ZyanVector* vector, const void* element)
     if (ZYCORE_VECTOR_SHOULD_GROW(vector->size + 1, vector->capacity))
     {
         ZYAN_CHECK(ZyanVectorReallocate(vector,
-            ZYAN_MAX(1, (ZyanUSize)((vector->size + 1) * vector->growth_factor))));
+            ZyanVectorCalculateCapacity(vector, vector->size + 1)));
     }
 
     void* const offset = ZYCORE_VECTOR_OFFSET(vector, vector->size);
@@ -455,28 +1877,10 @@ ZyanStatus ZyanVectorInsertRange(ZyanVector* vector, ZyanUSize index, const void
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
-    if (index > vector->size)
-    {
-        return ZYAN_STATUS_OUT_OF_RANGE;
-    }
-
-    ZYAN_ASSERT(vector->element_size);
-    ZYAN_ASSERT(vector->data);
-
-    if (ZYCORE_VECTOR_SHOULD_GROW(vector->size + count, vector->capacity))
-    {
-        ZYAN_CHECK(ZyanVectorReallocate(vector,
-            ZYAN_MAX(1, (ZyanUSize)((vector->size + count) * vector->growth_factor))));
-    }
-
-    if (index < vector->size)
-    {
-        ZYAN_CHECK(ZyanVectorShiftRight(vector, index, count));
-    }
 
-    void* const offset = ZYCORE_VECTOR_OFFSET(vector, index);
+    void* offset;
+    ZYAN_CHECK(ZyanVectorEmplaceRange(vector, index, count, &offset));
     ZYAN_MEMCPY(offset, elements, count * vector->element_size);
-    vector->size += count;
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -509,7 +1913,7 @@ ZyanStatus ZyanVectorEmplaceEx(ZyanVector* vector, ZyanUSize index, void** eleme
     if (ZYCORE_VECTOR_SHOULD_GROW(vector->size + 1, vector->capacity))
     {
         ZYAN_CHECK(ZyanVectorReallocate(vector,
-            ZYAN_MAX(1, (ZyanUSize)((vector->size + 1) * vector->growth_factor))));
+            ZyanVectorCalculateCapacity(vector, vector->size + 1)));
     }
 
     if (index < vector->size)
@@ -528,6 +1932,38 @@ ZyanStatus ZyanVectorEmplaceEx(ZyanVector* vector, ZyanUSize index, void** eleme
     return ZYAN_STATUS_SUCCESS;
 }
 
+ZyanStatus ZyanVectorEmplaceRange(ZyanVector* vector, ZyanUSize index, ZyanUSize count,
+    void** first)
+{
+    if (!vector || !count || !first)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index > vector->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    ZYAN_ASSERT(vector->element_size);
+    ZYAN_ASSERT(vector->data);
+
+    if (ZYCORE_VECTOR_SHOULD_GROW(vector->size + count, vector->capacity))
+    {
+        ZYAN_CHECK(ZyanVectorReallocate(vector,
+            ZyanVectorCalculateCapacity(vector, vector->size + count)));
+    }
+
+    if (index < vector->size)
+    {
+        ZYAN_CHECK(ZyanVectorShiftRight(vector, index, count));
+    }
+
+    *first = ZYCORE_VECTOR_OFFSET(vector, index);
+    vector->size += count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Utils                                                                                          */
 /* ---------------------------------------------------------------------------------------------- */
@@ -561,78 +1997,351 @@ ZyanStatus ZyanVectorSwapElements(ZyanVector* vector, ZyanUSize index_first, Zya
     return ZYAN_STATUS_SUCCESS;
 }
 
-/* ---------------------------------------------------------------------------------------------- */
-/* Deletion                                                                                       */
-/* ---------------------------------------------------------------------------------------------- */
-
-ZyanStatus ZyanVectorDelete(ZyanVector* vector, ZyanUSize index)
-{
-    return ZyanVectorDeleteRange(vector, index, 1);
-}
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanVectorDelete(ZyanVector* vector, ZyanUSize index)
+{
+    return ZyanVectorDeleteRange(vector, index, 1);
+}
+
+ZyanStatus ZyanVectorDeleteRange(ZyanVector* vector, ZyanUSize index, ZyanUSize count)
+{
+    if (!vector || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index + count > vector->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    if (vector->destructor)
+    {
+        for (ZyanUSize i = index; i < index + count; ++i)
+        {
+            vector->destructor(ZYCORE_VECTOR_OFFSET(vector, i));
+        }
+    }
+
+    if (index + count < vector->size)
+    {
+        ZYAN_CHECK(ZyanVectorShiftLeft(vector, index, count));
+    }
+
+    vector->size -= count;
+    if (ZyanVectorShouldShrink(vector, vector->size))
+    {
+        return ZyanVectorReallocate(vector, ZyanVectorCalculateCapacity(vector, vector->size));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanVectorDeleteUnordered(ZyanVector* vector, ZyanUSize index)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index >= vector->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    void* const element = ZYCORE_VECTOR_OFFSET(vector, index);
+    if (vector->destructor)
+    {
+        vector->destructor(element);
+    }
+
+    const ZyanUSize last = vector->size - 1;
+    if (index != last)
+    {
+        ZYAN_MEMCPY(element, ZYCORE_VECTOR_OFFSET(vector, last), vector->element_size);
+    }
+
+    vector->size = last;
+    if (ZyanVectorShouldShrink(vector, vector->size))
+    {
+        return ZyanVectorReallocate(vector, ZyanVectorCalculateCapacity(vector, vector->size));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanVectorRemoveIf(ZyanVector* vector, ZyanVectorPredicate predicate,
+    void* user_data)
+{
+    if (!vector || !predicate)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // Move each run of retained elements down with a single `memmove`
+    ZyanUSize write = 0;
+    ZyanUSize run = 0;
+    for (ZyanUSize i = 0; i < vector->size; ++i)
+    {
+        void* const element = ZYCORE_VECTOR_OFFSET(vector, i);
+        if (!predicate(element, user_data))
+        {
+            continue;
+        }
+
+        if (vector->destructor)
+        {
+            vector->destructor(element);
+        }
+        if ((i > run) && (write != run))
+        {
+            ZYAN_MEMMOVE(ZYCORE_VECTOR_OFFSET(vector, write), ZYCORE_VECTOR_OFFSET(vector, run),
+                (i - run) * vector->element_size);
+        }
+        write += i - run;
+        run = i + 1;
+    }
+
+    if (run == 0)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+    if ((vector->size > run) && (write != run))
+    {
+        ZYAN_MEMMOVE(ZYCORE_VECTOR_OFFSET(vector, write), ZYCORE_VECTOR_OFFSET(vector, run),
+            (vector->size - run) * vector->element_size);
+    }
+    write += vector->size - run;
+
+    vector->size = write;
+    if (ZyanVectorShouldShrink(vector, vector->size))
+    {
+        return ZyanVectorReallocate(vector, ZyanVectorCalculateCapacity(vector, vector->size));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanVectorPopBack(ZyanVector* vector)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (vector->size == 0)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    if (vector->destructor)
+    {
+         vector->destructor(ZYCORE_VECTOR_OFFSET(vector, vector->size - 1));
+    }
+
+    --vector->size;
+    if (ZyanVectorShouldShrink(vector, vector->size))
+    {
+        return ZyanVectorReallocate(vector, ZyanVectorCalculateCapacity(vector, vector->size));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanVectorClear(ZyanVector* vector)
+{
+    return ZyanVectorResizeEx(vector, 0, ZYAN_NULL);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Sorting                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanVectorSort(ZyanVector* vector, ZyanComparison comparison)
+{
+    if (!vector || !comparison)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (vector->size < 2)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZYAN_ASSERT(vector->element_size);
+    ZYAN_ASSERT(vector->data);
+
+    ZyanVectorSortContext context;
+    context.comparison   = comparison;
+    context.key_offset   = 0;
+    context.key_size     = 0;
+    context.element_size = vector->element_size;
+
+    ZyanVectorSortInPlace(&context, (ZyanU8*)vector->data, vector->size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+#ifndef ZYAN_NO_LIBC
 
-ZyanStatus ZyanVectorDeleteRange(ZyanVector* vector, ZyanUSize index, ZyanUSize count)
+ZyanStatus ZyanVectorSortParallel(ZyanVector* vector, ZyanComparison comparison,
+    ZyanUSize thread_count, ZyanAllocator* allocator)
 {
-    if (!vector || !count)
+    if (!vector || !comparison || !allocator)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
-    if (index + count > vector->size)
+    if (vector->size < 2)
     {
-        return ZYAN_STATUS_OUT_OF_RANGE;
+        return ZYAN_STATUS_SUCCESS;
     }
 
-    if (vector->destructor)
+    ZYAN_ASSERT(vector->element_size);
+    ZYAN_ASSERT(vector->data);
+
+    ZyanVectorSortContext context;
+    context.comparison   = comparison;
+    context.key_offset   = 0;
+    context.key_size     = 0;
+    context.element_size = vector->element_size;
+
+    if (!thread_count)
     {
-        for (ZyanUSize i = index; i < index + count; ++i)
-        {
-            vector->destructor(ZYCORE_VECTOR_OFFSET(vector, i));
-        }
+        ZyanU32 processor_count;
+        ZYAN_CHECK(ZyanThreadGetProcessorCount(&processor_count));
+        thread_count = processor_count;
+    }
+    thread_count = ZYAN_MIN(thread_count, ZYCORE_VECTOR_SORT_MAX_THREADS);
+    thread_count = ZYAN_MIN(thread_count, vector->size / ZYCORE_VECTOR_SORT_MIN_CHUNK);
+    if (thread_count < 2)
+    {
+        ZyanVectorSortInPlace(&context, (ZyanU8*)vector->data, vector->size);
+        return ZYAN_STATUS_SUCCESS;
     }
 
-    if (index + count < vector->size)
+    void* scratch;
+    ZYAN_CHECK(allocator->allocate(allocator, &scratch, vector->element_size, vector->size));
+
+    // Split the vector into one run per thread and distribute the remainder evenly
+    ZyanUSize bounds[ZYCORE_VECTOR_SORT_MAX_THREADS + 1];
+    const ZyanUSize chunk = vector->size / thread_count;
+    const ZyanUSize remainder = vector->size % thread_count;
+    for (ZyanUSize i = 0; i <= thread_count; ++i)
     {
-        ZYAN_CHECK(ZyanVectorShiftLeft(vector, index, count));
+        bounds[i] = i * chunk + ZYAN_MIN(i, remainder);
     }
 
-    vector->size -= count;
-    if (ZYCORE_VECTOR_SHOULD_SHRINK(vector->size, vector->capacity, vector->shrink_threshold))
+    // Copy the sorted runs to the scratch buffer, if an odd number of merge passes is required,
+    // so that the last pass ends up in the vector
+    ZyanUSize passes = 0;
+    for (ZyanUSize runs = thread_count; runs > 1; runs = (runs + 1) / 2)
+    {
+        ++passes;
+    }
+    ZyanU8* source = (ZyanU8*)vector->data;
+    ZyanU8* destination = (ZyanU8*)scratch;
+    if (passes & 1)
     {
-        return ZyanVectorReallocate(vector,
-            ZYAN_MAX(1, (ZyanUSize)(vector->size * vector->growth_factor)));
+        source = (ZyanU8*)scratch;
+        destination = (ZyanU8*)vector->data;
     }
 
-    return ZYAN_STATUS_SUCCESS;
+    ZyanVectorSortTask tasks[ZYCORE_VECTOR_SORT_MAX_THREADS];
+    for (ZyanUSize i = 0; i < thread_count; ++i)
+    {
+        tasks[i].context     = &context;
+        tasks[i].source      = (ZyanU8*)vector->data;
+        tasks[i].destination = (passes & 1) ? (ZyanU8*)scratch : ZYAN_NULL;
+        tasks[i].bounds      = bounds;
+        tasks[i].run_count   = 0;
+        tasks[i].begin       = bounds[i];
+        tasks[i].end         = bounds[i + 1];
+    }
+    ZyanVectorSortRunTasks(tasks, thread_count);
+
+    for (ZyanUSize runs = thread_count; runs > 1; runs = (runs + 1) / 2)
+    {
+        // Every thread produces an equally sized part of the merged output
+        for (ZyanUSize i = 0; i < thread_count; ++i)
+        {
+            tasks[i].source      = source;
+            tasks[i].destination = destination;
+            tasks[i].run_count   = runs;
+            tasks[i].begin       = i * chunk + ZYAN_MIN(i, remainder);
+            tasks[i].end         = (i + 1) * chunk + ZYAN_MIN(i + 1, remainder);
+        }
+        ZyanVectorSortRunTasks(tasks, thread_count);
+
+        for (ZyanUSize i = 0; i < (runs + 1) / 2; ++i)
+        {
+            bounds[i] = bounds[2 * i];
+        }
+        bounds[(runs + 1) / 2] = vector->size;
+
+        ZyanU8* const t = source;
+        source = destination;
+        destination = t;
+    }
+    ZYAN_ASSERT(source == vector->data);
+
+    return allocator->deallocate(allocator, scratch, vector->element_size, vector->size);
 }
 
-ZyanStatus ZyanVectorPopBack(ZyanVector* vector)
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanVectorSortByKey(ZyanVector* vector, ZyanUSize key_offset, ZyanUSize key_size)
 {
     if (!vector)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
-    if (vector->size == 0)
+    if ((key_size != 1) && (key_size != 2) && (key_size != 4) && (key_size != 8))
     {
-        return ZYAN_STATUS_OUT_OF_RANGE;
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if ((key_offset > vector->element_size) || (key_size > vector->element_size - key_offset))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (vector->size < 2)
+    {
+        return ZYAN_STATUS_SUCCESS;
     }
 
-    if (vector->destructor)
+    ZYAN_ASSERT(vector->element_size);
+    ZYAN_ASSERT(vector->data);
+
+    ZyanVectorSortContext context;
+    context.comparison   = ZYAN_NULL;
+    context.key_offset   = key_offset;
+    context.key_size     = key_size;
+    context.element_size = vector->element_size;
+
+    if (vector->size < ZYCORE_VECTOR_SORT_RADIX_THRESHOLD)
     {
-         vector->destructor(ZYCORE_VECTOR_OFFSET(vector, vector->size - 1));
+        ZyanVectorInsertionSort(&context, (ZyanU8*)vector->data, vector->size);
+        return ZYAN_STATUS_SUCCESS;
     }
 
-    --vector->size;
-    if (ZYCORE_VECTOR_SHOULD_SHRINK(vector->size, vector->capacity, vector->shrink_threshold))
+    ZyanAllocator* allocator = vector->allocator;
+#ifndef ZYAN_NO_LIBC
+    if (allocator == &ZyanVectorVirtualAllocator)
+    {
+        allocator = ZyanAllocatorDefault();
+    }
+#endif
+    if (!allocator)
     {
-        return ZyanVectorReallocate(vector,
-            ZYAN_MAX(1, (ZyanUSize)(vector->size * vector->growth_factor)));
+        // Vectors with a custom buffer can not allocate the scratch buffer
+        ZyanVectorSortInPlace(&context, (ZyanU8*)vector->data, vector->size);
+        return ZYAN_STATUS_SUCCESS;
     }
 
-    return ZYAN_STATUS_SUCCESS;
-}
+    void* scratch;
+    ZYAN_CHECK(allocator->allocate(allocator, &scratch, vector->element_size, vector->size));
+    ZyanVectorRadixSort(&context, (ZyanU8*)vector->data, (ZyanU8*)scratch, vector->size);
 
-ZyanStatus ZyanVectorClear(ZyanVector* vector)
-{
-    return ZyanVectorResizeEx(vector, 0, ZYAN_NULL);
+    return allocator->deallocate(allocator, scratch, vector->element_size, vector->size);
 }
 
 /* ---------------------------------------------------------------------------------------------- */
@@ -684,6 +2393,70 @@ ZyanStatus ZyanVectorFindEx(const ZyanVector* vector, const void* element, ZyanI
     return ZYAN_STATUS_FALSE;
 }
 
+ZyanStatus ZyanVectorFindBytes(const ZyanVector* vector, const void* element,
+    ZyanISize* found_index)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorFindBytesEx(vector, element, found_index, 0, vector->size);
+}
+
+ZyanStatus ZyanVectorFindBytesEx(const ZyanVector* vector, const void* element,
+    ZyanISize* found_index, ZyanUSize index, ZyanUSize count)
+{
+    if (!vector || !element || !found_index)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if ((index + count > vector->size) || (index == vector->size))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    if (!count)
+    {
+        *found_index = -1;
+        return ZYAN_STATUS_FALSE;
+    }
+
+    ZYAN_ASSERT(vector->element_size);
+    ZYAN_ASSERT(vector->data);
+
+    const ZyanUSize size = vector->element_size;
+    const ZyanU8* const data = (const ZyanU8*)ZYCORE_VECTOR_OFFSET(vector, index);
+    ZyanUSize i = 0;
+
+#if defined(ZYCORE_VECTOR_FIND_SIMD)
+    if ((size == 1) || (size == 2) || (size == 4) || (size == 8))
+    {
+        switch (ZyanVectorGetSimdLevel())
+        {
+        case ZYAN_VECTOR_SIMD_LEVEL_AVX2:
+            i = ZyanVectorFindBytesAVX2(data, count, element, size);
+            break;
+        case ZYAN_VECTOR_SIMD_LEVEL_SSE2:
+            i = ZyanVectorFindBytesSSE2(data, count, element, size);
+            break;
+        default:
+            break;
+        }
+    }
+#endif
+
+    i += ZyanVectorFindBytesScalar(data + i * size, count - i, element, size);
+    if (i < count)
+    {
+        *found_index = (ZyanISize)(index + i);
+        return ZYAN_STATUS_TRUE;
+    }
+
+    *found_index = -1;
+    return ZYAN_STATUS_FALSE;
+}
+
 ZyanStatus ZyanVectorBinarySearch(const ZyanVector* vector, const void* element,
     ZyanUSize* found_index, ZyanComparison comparison)
 {
@@ -740,6 +2513,219 @@ ZyanStatus ZyanVectorBinarySearchEx(const ZyanVector* vector, const void* elemen
     return status;
 }
 
+ZyanStatus ZyanVectorBinarySearchBranchless(const ZyanVector* vector, const void* element,
+    ZyanUSize* found_index, ZyanComparison comparison)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorBinarySearchBranchlessEx(vector, element, found_index, comparison, 0,
+        vector->size);
+}
+
+ZyanStatus ZyanVectorBinarySearchBranchlessEx(const ZyanVector* vector, const void* element,
+    ZyanUSize* found_index, ZyanComparison comparison, ZyanUSize index, ZyanUSize count)
+{
+    if (!vector || !element || !found_index || !comparison)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (((index >= vector->size) && (count > 0)) || (index + count > vector->size))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    if (!count)
+    {
+        *found_index = index;
+        return ZYAN_STATUS_FALSE;
+    }
+
+    ZYAN_ASSERT(vector->element_size);
+    ZYAN_ASSERT(vector->data);
+
+    const ZyanUSize lower_bound = ZyanVectorLowerBound(vector, element, comparison, index, count);
+    *found_index = lower_bound;
+    if ((lower_bound == index + count) ||
+        (comparison(ZYCORE_VECTOR_OFFSET(vector, lower_bound), element) != 0))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanVectorBinarySearchBatch(const ZyanVector* vector, const void* keys,
+    ZyanUSize key_count, ZyanUSize* out_indices, ZyanComparison comparison)
+{
+    if (!vector || !comparison || (key_count && (!keys || !out_indices)))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (!key_count)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZYAN_ASSERT(vector->element_size);
+    ZYAN_ASSERT(vector->data);
+
+    const ZyanUSize size = vector->element_size;
+    const ZyanU8* const key_data = (const ZyanU8*)keys;
+
+    ZyanBool sorted = ZYAN_TRUE;
+    for (ZyanUSize i = 1; (i < key_count) && sorted; ++i)
+    {
+        sorted = (comparison(key_data + (i - 1) * size, key_data + i * size) <= 0);
+    }
+
+    if (sorted)
+    {
+        // The lower bound of each key is not smaller than the one of the previous key. Gallop
+        // forward from there to find an upper limit and search the remaining small range
+        ZyanUSize lo = 0;
+        for (ZyanUSize i = 0; i < key_count; ++i)
+        {
+            const void* const key = key_data + i * size;
+            ZyanUSize hi = lo;
+            for (ZyanUSize step = 1; (hi < vector->size) &&
+                (comparison(ZYCORE_VECTOR_OFFSET(vector, hi), key) < 0); step *= 2)
+            {
+                lo = hi + 1;
+                hi = ZYAN_MIN(hi + step, vector->size);
+            }
+            lo = ZyanVectorLowerBound(vector, key, comparison, lo, hi - lo);
+            out_indices[i] = lo;
+        }
+
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // Run groups of independent searches in lockstep, so that their cache misses overlap
+    const ZyanU8* const first = (const ZyanU8*)vector->data;
+    for (ZyanUSize i = 0; i < key_count; i += ZYCORE_VECTOR_SEARCH_BATCH_WIDTH)
+    {
+        const ZyanUSize width = ZYAN_MIN(key_count - i, ZYCORE_VECTOR_SEARCH_BATCH_WIDTH);
+        const ZyanU8* bases[ZYCORE_VECTOR_SEARCH_BATCH_WIDTH];
+        for (ZyanUSize j = 0; j < width; ++j)
+        {
+            bases[j] = first;
+        }
+
+        ZyanUSize n = vector->size;
+        while (n > 1)
+        {
+            const ZyanUSize half = n / 2;
+            n -= half;
+            for (ZyanUSize j = 0; j < width; ++j)
+            {
+                const void* const key = key_data + (i + j) * size;
+                const ZyanU8* const middle = bases[j] + half * size;
+                bases[j] = (comparison(middle, key) < 0) ? middle : bases[j];
+                ZYCORE_VECTOR_PREFETCH(bases[j] + (n / 2) * size);
+            }
+        }
+
+        for (ZyanUSize j = 0; j < width; ++j)
+        {
+            const void* const key = key_data + (i + j) * size;
+            const ZyanUSize index = (ZyanUSize)(bases[j] - first) / size;
+            out_indices[i + j] = (vector->size && (comparison(bases[j], key) < 0)) ?
+                index + 1 : index;
+        }
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanVectorBuildEytzinger(ZyanVector* destination, const ZyanVector* source)
+{
+    if (!destination || !source || (destination == source) || destination->destructor ||
+        (destination->element_size != source->element_size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(source->element_size);
+    ZYAN_ASSERT(source->data);
+
+    const ZyanUSize n = source->size;
+    ZYAN_CHECK(ZyanVectorResize(destination, n + 1));
+    if (!n)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // Visit the implicit tree in-order, starting with the leftmost node
+    ZyanUSize k = 1;
+    while (2 * k <= n)
+    {
+        k *= 2;
+    }
+    for (ZyanUSize i = 0; i < n; ++i)
+    {
+        ZYAN_MEMCPY(ZYCORE_VECTOR_OFFSET(destination, k), ZYCORE_VECTOR_OFFSET(source, i),
+            source->element_size);
+
+        if (2 * k + 1 <= n)
+        {
+            k = 2 * k + 1;
+            while (2 * k <= n)
+            {
+                k *= 2;
+            }
+        } else
+        {
+            while (k & 1)
+            {
+                k >>= 1;
+            }
+            k >>= 1;
+        }
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanVectorEytzingerSearch(const ZyanVector* vector, const void* element,
+    ZyanUSize* found_index, ZyanComparison comparison)
+{
+    if (!vector || !element || !found_index || !comparison || !vector->size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(vector->element_size);
+    ZYAN_ASSERT(vector->data);
+
+    const ZyanUSize size = vector->element_size;
+    const ZyanU8* const data = (const ZyanU8*)vector->data;
+    const ZyanUSize n = vector->size - 1;
+    ZyanUSize k = 1;
+    while (k <= n)
+    {
+        ZYCORE_VECTOR_PREFETCH(data +
+            ZYAN_MIN(k << ZYCORE_VECTOR_EYTZINGER_PREFETCH_LEVELS, n) * size);
+        k = 2 * k + (comparison(data + k * size, element) < 0);
+    }
+
+    // Undo all trailing right turns and the last left turn to get to the lower bound
+    while (k & 1)
+    {
+        k >>= 1;
+    }
+    k >>= 1;
+
+    *found_index = k;
+    if (!k)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+    return (comparison(data + k * size, element) == 0) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Memory management                                                                              */
 /* ---------------------------------------------------------------------------------------------- */
@@ -768,11 +2754,12 @@ ZyanStatus ZyanVectorResizeEx(ZyanVector* vector, ZyanUSize size, const void* in
         }
     }
 
+    // Only resizes that make the vector smaller count towards the shrink hysteresis
     if (ZYCORE_VECTOR_SHOULD_GROW(size, vector->capacity) ||
-        ZYCORE_VECTOR_SHOULD_SHRINK(size, vector->capacity, vector->shrink_threshold))
+        ((size < vector->size) && ZyanVectorShouldShrink(vector, size)))
     {
         ZYAN_ASSERT(vector->growth_factor >= 1);
-        ZYAN_CHECK(ZyanVectorReallocate(vector, (ZyanUSize)(size * vector->growth_factor)));
+        ZYAN_CHECK(ZyanVectorReallocate(vector, ZyanVectorCalculateCapacity(vector, size)));
     }
 
     if (initializer && (size > vector->size))
@@ -813,6 +2800,43 @@ ZyanStatus ZyanVectorShrinkToFit(ZyanVector* vector)
     return ZyanVectorReallocate(vector, vector->size);
 }
 
+ZyanStatus ZyanVectorGrowthPolicyInit(ZyanVectorGrowthPolicy* policy)
+{
+    if (!policy)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    policy->growth_numerator   = 3;
+    policy->growth_denominator = 2;
+    policy->max_growth_step    = 0;
+    policy->page_size          = 4 * 1024;
+    policy->page_threshold     = 64 * 1024;
+    policy->shrink_threshold   = ZYAN_VECTOR_DEFAULT_SHRINK_THRESHOLD;
+    policy->shrink_delay       = ZYAN_VECTOR_DEFAULT_SHRINK_DELAY;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanVectorSetGrowthPolicy(ZyanVector* vector, const ZyanVectorGrowthPolicy* policy)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (policy && (!policy->growth_denominator ||
+        (policy->growth_numerator < policy->growth_denominator) ||
+        !ZYAN_IS_POWER_OF_2(policy->page_size)))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    vector->growth_policy  = policy;
+    vector->shrink_pending = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Information                                                                                    */
 /* ---------------------------------------------------------------------------------------------- */
@@ -0,0 +1,561 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the custom `ZyanAllocator` implementations.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/API/Memory.h>
+#include <Zycore/ArenaAllocator.h>
+#include <Zycore/List.h>
+#include <Zycore/PoolAllocator.h>
+#include <Zycore/StatsAllocator.h>
+#include <Zycore/String.h>
+#include <Zycore/ThreadCacheAllocator.h>
+#include <Zycore/TlsfAllocator.h>
+#include <Zycore/Vector.h>
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Arena allocator                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+TEST(ArenaAllocatorTest, GrowInPlace)
+{
+    ZyanArenaAllocator arena;
+    ASSERT_EQ(ZyanArenaInit(&arena, 4096), ZYAN_STATUS_SUCCESS);
+
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInitEx(&vector, sizeof(ZyanU32), 1,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), &arena.allocator, 2, 0),
+        ZYAN_STATUS_SUCCESS);
+    const void* const data = vector.data;
+
+    // The vector is the most recent allocation, so growing it must not move the data
+    for (ZyanU32 i = 0; i < 512; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+    }
+    EXPECT_EQ(vector.data, data);
+
+    // A second allocation forces the next reallocation to copy
+    void* other;
+    ASSERT_EQ(arena.allocator.allocate(&arena.allocator, &other, 1, 16), ZYAN_STATUS_SUCCESS);
+    EXPECT_TRUE(ZYAN_IS_ALIGNED_TO((ZyanUPointer)other, ZYAN_ARENA_ALIGNMENT));
+    for (ZyanU32 i = 512; i < 4096; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+    }
+    EXPECT_NE(vector.data, data);
+    for (ZyanU32 i = 0; i < 4096; ++i)
+    {
+        ASSERT_EQ(ZYAN_VECTOR_GET(ZyanU32, &vector, i), i);
+    }
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanArenaDestroy(&arena), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(ArenaAllocatorTest, Reset)
+{
+    ZyanArenaAllocator arena;
+    ASSERT_EQ(ZyanArenaInit(&arena, 256), ZYAN_STATUS_SUCCESS);
+
+    void* first;
+    ASSERT_EQ(arena.allocator.allocate(&arena.allocator, &first, 1, 64), ZYAN_STATUS_SUCCESS);
+    for (ZyanUSize i = 0; i < 64; ++i)
+    {
+        void* p;
+        ASSERT_EQ(arena.allocator.allocate(&arena.allocator, &p, 1, 64), ZYAN_STATUS_SUCCESS);
+    }
+
+    // The chunks are reused after a reset
+    ASSERT_EQ(ZyanArenaReset(&arena), ZYAN_STATUS_SUCCESS);
+    void* p;
+    ASSERT_EQ(arena.allocator.allocate(&arena.allocator, &p, 1, 64), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(p, first);
+
+    EXPECT_EQ(ZyanArenaDestroy(&arena), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(ArenaAllocatorTest, CustomBuffer)
+{
+    ZyanU8 buffer[512];
+    ZyanArenaAllocator arena;
+    ASSERT_EQ(ZyanArenaInitCustomBuffer(&arena, buffer, sizeof(buffer)), ZYAN_STATUS_SUCCESS);
+
+    void* p;
+    ASSERT_EQ(arena.allocator.allocate(&arena.allocator, &p, 1, 128), ZYAN_STATUS_SUCCESS);
+    EXPECT_GE(static_cast<ZyanU8*>(p), buffer);
+    EXPECT_LT(static_cast<ZyanU8*>(p), buffer + sizeof(buffer));
+    EXPECT_EQ(arena.allocator.allocate(&arena.allocator, &p, 1, 1024),
+        ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+
+    EXPECT_EQ(ZyanArenaDestroy(&arena), ZYAN_STATUS_SUCCESS);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Pool allocator                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+TEST(PoolAllocatorTest, Recycle)
+{
+    ZyanPoolAllocator pool;
+    ASSERT_EQ(ZyanPoolInit(&pool, 24, 4), ZYAN_STATUS_SUCCESS);
+
+    ZyanUSize block_size;
+    ASSERT_EQ(ZyanPoolGetBlockSize(&pool, &block_size), ZYAN_STATUS_SUCCESS);
+    EXPECT_GE(block_size, static_cast<ZyanUSize>(24));
+
+    void* blocks[16];
+    for (auto& block : blocks)
+    {
+        ASSERT_EQ(pool.allocator.allocate(&pool.allocator, &block, 1, 24), ZYAN_STATUS_SUCCESS);
+        EXPECT_TRUE(ZYAN_IS_ALIGNED_TO((ZyanUPointer)block, ZYAN_POOL_ALIGNMENT));
+    }
+    void* large;
+    EXPECT_EQ(pool.allocator.allocate(&pool.allocator, &large, 1, block_size + 1),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+
+    // Released blocks are handed out again in LIFO order
+    ASSERT_EQ(pool.allocator.deallocate(&pool.allocator, blocks[5], 1, 24), ZYAN_STATUS_SUCCESS);
+    void* p;
+    ASSERT_EQ(pool.allocator.allocate(&pool.allocator, &p, 1, 24), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(p, blocks[5]);
+
+    EXPECT_EQ(ZyanPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(PoolAllocatorTest, List)
+{
+    ZyanPoolAllocator pool;
+    ASSERT_EQ(ZyanPoolInit(&pool, ZYAN_LIST_NODE_SIZE(sizeof(ZyanU64)), 0),
+        ZYAN_STATUS_SUCCESS);
+
+    ZyanList list;
+    EXPECT_EQ(ZyanListInitPooled(&list, sizeof(ZyanU64) * 4,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), &pool), ZYAN_STATUS_INVALID_ARGUMENT);
+    ASSERT_EQ(ZyanListInitPooled(&list, sizeof(ZyanU64),
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), &pool), ZYAN_STATUS_SUCCESS);
+
+    for (ZyanU64 i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(ZyanListPushBack(&list, &i), ZYAN_STATUS_SUCCESS);
+        if (i % 3 == 0)
+        {
+            ASSERT_EQ(ZyanListPopFront(&list), ZYAN_STATUS_SUCCESS);
+        }
+    }
+
+    ZyanUSize size;
+    ASSERT_EQ(ZyanListGetSize(&list, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, static_cast<ZyanUSize>(666));
+    const ZyanListNode* node;
+    ASSERT_EQ(ZyanListGetTailNode(&list, &node), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZYAN_LIST_GET(ZyanU64, node), 999);
+
+    EXPECT_EQ(ZyanListDestroy(&list), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(PoolAllocatorTest, CustomBuffer)
+{
+    ZyanU8 buffer[256];
+    ZyanPoolAllocator pool;
+    ASSERT_EQ(ZyanPoolInitCustomBuffer(&pool, 32, buffer, sizeof(buffer)), ZYAN_STATUS_SUCCESS);
+
+    ZyanUSize count = 0;
+    void* p;
+    while (pool.allocator.allocate(&pool.allocator, &p, 1, 32) == ZYAN_STATUS_SUCCESS)
+    {
+        EXPECT_GE(static_cast<ZyanU8*>(p), buffer);
+        EXPECT_LE(static_cast<ZyanU8*>(p) + 32, buffer + sizeof(buffer));
+        ++count;
+    }
+    EXPECT_GE(count, static_cast<ZyanUSize>(7));
+
+    EXPECT_EQ(ZyanPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Stats allocator                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+TEST(StatsAllocatorTest, Vector)
+{
+    ZyanStatsAllocator stats;
+    ASSERT_EQ(ZyanStatsAllocatorInit(&stats), ZYAN_STATUS_SUCCESS);
+
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInitEx(&vector, sizeof(ZyanU32), 4,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), &stats.allocator, 2, 0),
+        ZYAN_STATUS_SUCCESS);
+    for (ZyanU32 i = 0; i < 16; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+    }
+
+    ZyanStatsAllocatorSnapshot snapshot;
+    ASSERT_EQ(ZyanStatsAllocatorGetSnapshot(&stats, &snapshot), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(snapshot.allocations, 1u);
+    EXPECT_EQ(snapshot.reallocations, 2u);
+    EXPECT_EQ(snapshot.deallocations, 0u);
+    EXPECT_EQ(snapshot.live_bytes, vector.capacity * sizeof(ZyanU32));
+    EXPECT_EQ(snapshot.peak_bytes, snapshot.live_bytes);
+    EXPECT_EQ(snapshot.histogram[4], 1u);   // 16 bytes
+    EXPECT_EQ(snapshot.histogram[6], 1u);   // 40 bytes
+    EXPECT_EQ(snapshot.histogram[7], 1u);   // 88 bytes
+
+    ASSERT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanStatsAllocatorGetSnapshot(&stats, &snapshot), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(snapshot.deallocations, 1u);
+    EXPECT_EQ(snapshot.live_bytes, 0u);
+    EXPECT_EQ(snapshot.peak_bytes, 88u);
+
+    ASSERT_EQ(ZyanStatsAllocatorReset(&stats), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanStatsAllocatorGetSnapshot(&stats, &snapshot), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(snapshot.allocations, 0u);
+    EXPECT_EQ(snapshot.peak_bytes, 0u);
+}
+
+TEST(StatsAllocatorTest, String)
+{
+    ZyanStatsAllocator stats;
+    ASSERT_EQ(ZyanStatsAllocatorInit(&stats), ZYAN_STATUS_SUCCESS);
+
+    ZyanString string;
+    ASSERT_EQ(ZyanStringInitEx(&string, 0, &stats.allocator, 2, 0), ZYAN_STATUS_SUCCESS);
+    for (int i = 0; i < 100; ++i)
+    {
+        ZyanStringView view;
+        ASSERT_EQ(ZyanStringViewInsideBuffer(&view, "abc"), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanStringAppend(&string, &view), ZYAN_STATUS_SUCCESS);
+    }
+    ASSERT_EQ(ZyanStringDestroy(&string), ZYAN_STATUS_SUCCESS);
+
+    ZyanStatsAllocatorSnapshot snapshot;
+    ASSERT_EQ(ZyanStatsAllocatorGetSnapshot(&stats, &snapshot), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(snapshot.allocations, snapshot.deallocations);
+    EXPECT_GT(snapshot.reallocations, 0u);
+    EXPECT_EQ(snapshot.live_bytes, 0u);
+    EXPECT_GE(snapshot.peak_bytes, 301u);
+}
+
+TEST(StatsAllocatorTest, Expand)
+{
+    ZyanArenaAllocator arena;
+    ASSERT_EQ(ZyanArenaInit(&arena, 4096), ZYAN_STATUS_SUCCESS);
+    ZyanStatsAllocator stats;
+    ASSERT_EQ(ZyanStatsAllocatorInitEx(&stats, &arena.allocator), ZYAN_STATUS_SUCCESS);
+
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInitEx(&vector, sizeof(ZyanU32), 4,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), &stats.allocator, 2, 0),
+        ZYAN_STATUS_SUCCESS);
+    const void* const data = vector.data;
+    for (ZyanU32 i = 0; i < 64; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+    }
+
+    // The arena grows its most recent block in place, so the vector never calls `reallocate`
+    EXPECT_EQ(vector.data, data);
+    ZyanStatsAllocatorSnapshot snapshot;
+    ASSERT_EQ(ZyanStatsAllocatorGetSnapshot(&stats, &snapshot), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(snapshot.allocations, 1u);
+    EXPECT_EQ(snapshot.reallocations, 0u);
+    EXPECT_GT(snapshot.expansions, 0u);
+    EXPECT_EQ(snapshot.live_bytes, vector.capacity * sizeof(ZyanU32));
+    for (ZyanU32 i = 0; i < 64; ++i)
+    {
+        ASSERT_EQ(ZYAN_VECTOR_GET(ZyanU32, &vector, i), i);
+    }
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanArenaDestroy(&arena), ZYAN_STATUS_SUCCESS);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* TLSF allocator                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+TEST(TlsfAllocatorTest, Coalesce)
+{
+    alignas(16) static ZyanU8 buffer[64 * 1024];
+    ZyanTlsfAllocator tlsf;
+    ASSERT_EQ(ZyanTlsfInit(&tlsf, buffer, sizeof(buffer)), ZYAN_STATUS_SUCCESS);
+
+    // Fill the whole region with blocks of varying sizes
+    std::vector<void*> blocks;
+    for (ZyanUSize i = 0; ; ++i)
+    {
+        const ZyanUSize size = 1 + (i * 37) % 700;
+        void* p;
+        const ZyanStatus status = tlsf.allocator.allocate(&tlsf.allocator, &p, 1, size);
+        if (status == ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE)
+        {
+            break;
+        }
+        ASSERT_EQ(status, ZYAN_STATUS_SUCCESS);
+        EXPECT_TRUE(ZYAN_IS_ALIGNED_TO((ZyanUPointer)p, ZYAN_TLSF_ALIGNMENT));
+        std::memset(p, static_cast<int>(i), size);
+        blocks.push_back(p);
+    }
+    EXPECT_GT(blocks.size(), 100u);
+
+    // Releasing all blocks in any order merges them back into a single block
+    std::reverse(blocks.begin(), blocks.begin() + blocks.size() / 2);
+    for (ZyanUSize i = 0; i < blocks.size(); i += 2)
+    {
+        ASSERT_EQ(tlsf.allocator.deallocate(&tlsf.allocator, blocks[i], 1, 1), ZYAN_STATUS_SUCCESS);
+    }
+    for (ZyanUSize i = 1; i < blocks.size(); i += 2)
+    {
+        ASSERT_EQ(tlsf.allocator.deallocate(&tlsf.allocator, blocks[i], 1, 1), ZYAN_STATUS_SUCCESS);
+    }
+    void* p;
+    ASSERT_EQ(tlsf.allocator.allocate(&tlsf.allocator, &p, 1, 60 * 1024), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(TlsfAllocatorTest, Vector)
+{
+    alignas(16) static ZyanU8 buffer[256 * 1024];
+    ZyanTlsfAllocator tlsf;
+    ASSERT_EQ(ZyanTlsfInit(&tlsf, buffer, sizeof(buffer)), ZYAN_STATUS_SUCCESS);
+
+    ZyanVector a;
+    ZyanVector b;
+    ASSERT_EQ(ZyanVectorInitEx(&a, sizeof(ZyanU32), 4,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), &tlsf.allocator, 2, 0),
+        ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanVectorInitEx(&b, sizeof(ZyanU32), 4,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), &tlsf.allocator, 2, 0),
+        ZYAN_STATUS_SUCCESS);
+
+    // `b` is followed by free memory and grows in place, while `a` has to move
+    const void* const data = b.data;
+    for (ZyanU32 i = 0; i < 8192; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(&b, &i), ZYAN_STATUS_SUCCESS);
+    }
+    EXPECT_EQ(b.data, data);
+    for (ZyanU32 i = 0; i < 8192; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(&a, &i), ZYAN_STATUS_SUCCESS);
+    }
+    for (ZyanU32 i = 0; i < 8192; ++i)
+    {
+        ASSERT_EQ(ZYAN_VECTOR_GET(ZyanU32, &a, i), i);
+        ASSERT_EQ(ZYAN_VECTOR_GET(ZyanU32, &b, i), i);
+    }
+
+    // The region is exhausted, but a second region allows further growth
+    alignas(16) static ZyanU8 more[1024 * 1024];
+    ZyanU32 value = 0;
+    ZyanStatus status;
+    do
+    {
+        status = ZyanVectorPushBack(&b, &value);
+    } while (status == ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(status, ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+    const ZyanUSize size = b.size;
+    ASSERT_EQ(ZyanTlsfAddRegion(&tlsf, more, sizeof(more)), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanVectorPushBack(&b, &value), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(b.size, size + 1);
+
+    EXPECT_EQ(ZyanVectorDestroy(&a), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanVectorDestroy(&b), ZYAN_STATUS_SUCCESS);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Thread-caching allocator                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+TEST(ThreadCacheAllocatorTest, Recycle)
+{
+    ZyanThreadCacheAllocator tca;
+    ASSERT_EQ(ZyanThreadCacheInit(&tca, 0), ZYAN_STATUS_SUCCESS);
+
+    void* a;
+    ASSERT_EQ(tca.allocator.allocate(&tca.allocator, &a, 1, 100), ZYAN_STATUS_SUCCESS);
+    EXPECT_TRUE(ZYAN_IS_ALIGNED_TO((ZyanUPointer)a, ZYAN_THREAD_CACHE_ALIGNMENT));
+    ASSERT_EQ(tca.allocator.deallocate(&tca.allocator, a, 1, 100), ZYAN_STATUS_SUCCESS);
+
+    // Any request of the same size-class is served from the magazine
+    void* b;
+    ASSERT_EQ(tca.allocator.allocate(&tca.allocator, &b, 1, 128), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(a, b);
+
+    // Growing within the size-class keeps the block, growing beyond moves the data
+    static_cast<ZyanU8*>(b)[0] = 0xAB;
+    ASSERT_EQ(tca.allocator.reallocate(&tca.allocator, &b, 1, 120), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(a, b);
+    ASSERT_EQ(tca.allocator.reallocate(&tca.allocator, &b, 1, 8192), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(static_cast<ZyanU8*>(b)[0], 0xAB);
+    ASSERT_EQ(tca.allocator.deallocate(&tca.allocator, b, 1, 8192), ZYAN_STATUS_SUCCESS);
+
+    EXPECT_EQ(ZyanThreadCacheFlush(&tca), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanThreadCacheDestroy(&tca), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(ThreadCacheAllocatorTest, RemoteFree)
+{
+    ZyanThreadCacheAllocator tca;
+    ASSERT_EQ(ZyanThreadCacheInit(&tca, 0), ZYAN_STATUS_SUCCESS);
+
+    std::vector<void*> blocks(32);
+    for (auto& block : blocks)
+    {
+        ASSERT_EQ(tca.allocator.allocate(&tca.allocator, &block, 1, 64), ZYAN_STATUS_SUCCESS);
+    }
+
+    std::thread thread([&]
+    {
+        for (auto block : blocks)
+        {
+            EXPECT_EQ(tca.allocator.deallocate(&tca.allocator, block, 1, 64),
+                ZYAN_STATUS_SUCCESS);
+        }
+    });
+    thread.join();
+
+    // Blocks released by the other thread are handed back to the owning thread
+    void* p;
+    ASSERT_EQ(tca.allocator.allocate(&tca.allocator, &p, 1, 64), ZYAN_STATUS_SUCCESS);
+    EXPECT_NE(std::find(blocks.begin(), blocks.end(), p), blocks.end());
+    ASSERT_EQ(tca.allocator.deallocate(&tca.allocator, p, 1, 64), ZYAN_STATUS_SUCCESS);
+
+    EXPECT_EQ(ZyanThreadCacheDestroy(&tca), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(ThreadCacheAllocatorTest, OrphanedBlocks)
+{
+    ZyanThreadCacheAllocator tca;
+    ASSERT_EQ(ZyanThreadCacheInit(&tca, 4), ZYAN_STATUS_SUCCESS);
+
+    constexpr ZyanU32 thread_count = 4;
+    constexpr ZyanU32 count = 400;
+    std::vector<ZyanVector> vectors(thread_count);
+    std::vector<std::thread> threads;
+    for (auto& vector : vectors)
+    {
+        threads.emplace_back([&]
+        {
+            ASSERT_EQ(ZyanVectorInitEx(&vector, sizeof(ZyanU32), 1,
+                reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), &tca.allocator, 2, 0),
+                ZYAN_STATUS_SUCCESS);
+            for (ZyanU32 i = 0; i < count; ++i)
+            {
+                ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // The owning threads have exited, so the blocks are released to the backing allocator
+    for (auto& vector : vectors)
+    {
+        ASSERT_EQ(vector.size, count);
+        EXPECT_EQ(*static_cast<const ZyanU32*>(ZyanVectorGet(&vector, count - 1)), count - 1);
+        EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+    }
+
+    EXPECT_EQ(ZyanThreadCacheDestroy(&tca), ZYAN_STATUS_SUCCESS);
+}
+
+#endif // ZYAN_NO_LIBC
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Large page allocator                                                                           */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+TEST(LargePageAllocatorTest, Vector)
+{
+    const ZyanUSize large_page_size = ZyanMemoryGetLargePageSize();
+    EXPECT_TRUE(ZYAN_IS_POWER_OF_2(large_page_size));
+
+    ZyanAllocator* const allocator = ZyanAllocatorLargePage();
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInitEx(&vector, sizeof(ZyanU32), 16,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), allocator, 2, 0),
+        ZYAN_STATUS_SUCCESS);
+
+    // Growing inside the first mapping never moves the data. Without large page support, the
+    // allocator falls back to regular pages, which are too small to hold all elements
+    const void* const data = vector.data;
+    for (ZyanU32 i = 0; i < 1024; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+    }
+    if (large_page_size)
+    {
+        EXPECT_EQ(vector.data, data);
+    }
+
+    const ZyanU32 count = 1024 * 1024;
+    for (ZyanU32 i = 1024; i < count; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+    }
+    for (ZyanU32 i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(ZYAN_VECTOR_GET(ZyanU32, &vector, i), i);
+    }
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+#endif // ZYAN_NO_LIBC
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,260 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanDeque` implementation.
+ */
+
+#include <cstdlib>
+#include <deque>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/Deque.h>
+#include <Zycore/StatsAllocator.h>
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   The number of `ZyanU64` objects passed to `FreeZyanU64`.
+ */
+static ZyanUSize g_freed_count = 0;
+
+/**
+ * @brief   A dummy destructor for `ZyanU64` objects, that counts the destroyed objects.
+ *
+ * @param   object  A pointer to the object.
+ */
+static void FreeZyanU64(ZyanU64* object)
+{
+    ZYAN_UNUSED(object);
+    ++g_freed_count;
+}
+
+/**
+ * @brief   Compares the contents of a `ZyanDeque` with the given reference.
+ *
+ * @param   deque       A pointer to the `ZyanDeque` instance.
+ * @param   reference   The reference container.
+ */
+static void ExpectEqual(const ZyanDeque* deque, const std::deque<ZyanU64>& reference)
+{
+    ASSERT_EQ(deque->size, reference.size());
+    for (ZyanUSize i = 0; i < reference.size(); ++i)
+    {
+        EXPECT_EQ(ZYAN_DEQUE_GET(ZyanU64, deque, i), reference[i]);
+    }
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+#ifndef ZYAN_NO_LIBC
+
+TEST(DequeTest, InitBasic)
+{
+    ZyanDeque deque;
+    ASSERT_EQ(ZyanDequeInit(&deque, sizeof(ZyanU64), 10,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(deque.size, static_cast<ZyanUSize>(0));
+    EXPECT_EQ(deque.capacity, static_cast<ZyanUSize>(16));
+    EXPECT_EQ(deque.element_size, sizeof(ZyanU64));
+    EXPECT_NE(deque.data, ZYAN_NULL);
+    EXPECT_EQ(ZyanDequeGet(&deque, 0), ZYAN_NULL);
+    EXPECT_EQ(ZyanDequePopFront(&deque, ZYAN_NULL), ZYAN_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(ZyanDequePopBack(&deque, ZYAN_NULL), ZYAN_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(ZyanDequeDestroy(&deque), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(DequeTest, PushPop)
+{
+    ZyanDeque deque;
+    ASSERT_EQ(ZyanDequeInit(&deque, sizeof(ZyanU64), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+
+    std::srand(1337);
+    std::deque<ZyanU64> reference;
+    std::vector<ZyanU64> buffer;
+    for (ZyanU64 i = 0; i < 5000; ++i)
+    {
+        const ZyanUSize count = static_cast<ZyanUSize>(std::rand() % 8) + 1;
+        switch (std::rand() % 6)
+        {
+        case 0:
+            ASSERT_EQ(ZyanDequePushBack(&deque, &i), ZYAN_STATUS_SUCCESS);
+            reference.push_back(i);
+            break;
+        case 1:
+            ASSERT_EQ(ZyanDequePushFront(&deque, &i), ZYAN_STATUS_SUCCESS);
+            reference.push_front(i);
+            break;
+        case 2:
+            buffer.assign(count, 0);
+            for (ZyanUSize j = 0; j < count; ++j)
+            {
+                buffer[j] = i * 8 + j;
+                reference.push_back(buffer[j]);
+            }
+            ASSERT_EQ(ZyanDequePushBackRange(&deque, buffer.data(), count), ZYAN_STATUS_SUCCESS);
+            break;
+        case 3:
+        {
+            ZyanU64 element;
+            if (reference.empty())
+            {
+                EXPECT_EQ(ZyanDequePopFront(&deque, &element), ZYAN_STATUS_OUT_OF_RANGE);
+                break;
+            }
+            ASSERT_EQ(ZyanDequePopFront(&deque, &element), ZYAN_STATUS_SUCCESS);
+            EXPECT_EQ(element, reference.front());
+            reference.pop_front();
+            break;
+        }
+        case 4:
+        {
+            ZyanU64 element;
+            if (reference.empty())
+            {
+                EXPECT_EQ(ZyanDequePopBack(&deque, &element), ZYAN_STATUS_OUT_OF_RANGE);
+                break;
+            }
+            ASSERT_EQ(ZyanDequePopBack(&deque, &element), ZYAN_STATUS_SUCCESS);
+            EXPECT_EQ(element, reference.back());
+            reference.pop_back();
+            break;
+        }
+        case 5:
+            buffer.assign(count, 0);
+            if (count > reference.size())
+            {
+                EXPECT_EQ(ZyanDequePopFrontRange(&deque, buffer.data(), count),
+                    ZYAN_STATUS_OUT_OF_RANGE);
+                break;
+            }
+            ASSERT_EQ(ZyanDequePopFrontRange(&deque, buffer.data(), count), ZYAN_STATUS_SUCCESS);
+            for (ZyanUSize j = 0; j < count; ++j)
+            {
+                EXPECT_EQ(buffer[j], reference.front());
+                reference.pop_front();
+            }
+            break;
+        default:
+            break;
+        }
+
+        // The capacity stays a power of two
+        ASSERT_EQ(deque.capacity & (deque.capacity - 1), static_cast<ZyanUSize>(0));
+    }
+    ExpectEqual(&deque, reference);
+
+    ASSERT_EQ(ZyanDequeShrinkToFit(&deque), ZYAN_STATUS_SUCCESS);
+    EXPECT_LT(deque.capacity, reference.size() * 2);
+    ExpectEqual(&deque, reference);
+
+    EXPECT_EQ(ZyanDequeDestroy(&deque), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(DequeTest, SteadyState)
+{
+    ZyanStatsAllocator stats;
+    ASSERT_EQ(ZyanStatsAllocatorInit(&stats), ZYAN_STATUS_SUCCESS);
+
+    ZyanDeque deque;
+    ASSERT_EQ(ZyanDequeInitEx(&deque, sizeof(ZyanU64), 64,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), &stats.allocator), ZYAN_STATUS_SUCCESS);
+
+    // A queue that never exceeds its capacity does not allocate, even if it wraps around
+    ZyanU64 elements[48];
+    for (ZyanU64 i = 0; i < 100; ++i)
+    {
+        for (ZyanUSize j = 0; j < ZYAN_ARRAY_LENGTH(elements); ++j)
+        {
+            elements[j] = i * ZYAN_ARRAY_LENGTH(elements) + j;
+        }
+        ASSERT_EQ(ZyanDequePushBackRange(&deque, elements, ZYAN_ARRAY_LENGTH(elements)),
+            ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanDequePopFrontRange(&deque, elements, ZYAN_ARRAY_LENGTH(elements)),
+            ZYAN_STATUS_SUCCESS);
+        for (ZyanUSize j = 0; j < ZYAN_ARRAY_LENGTH(elements); ++j)
+        {
+            ASSERT_EQ(elements[j], i * ZYAN_ARRAY_LENGTH(elements) + j);
+        }
+    }
+    EXPECT_EQ(deque.capacity, static_cast<ZyanUSize>(64));
+
+    ZyanStatsAllocatorSnapshot snapshot;
+    ASSERT_EQ(ZyanStatsAllocatorGetSnapshot(&stats, &snapshot), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(snapshot.allocations, 1u);
+
+    EXPECT_EQ(ZyanDequeDestroy(&deque), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanStatsAllocatorGetSnapshot(&stats, &snapshot), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(snapshot.live_bytes, 0u);
+}
+
+TEST(DequeTest, Destructor)
+{
+    ZyanDeque deque;
+    ASSERT_EQ(ZyanDequeInit(&deque, sizeof(ZyanU64), 4,
+        reinterpret_cast<ZyanMemberProcedure>(&FreeZyanU64)), ZYAN_STATUS_SUCCESS);
+
+    for (ZyanU64 i = 0; i < 10; ++i)
+    {
+        ASSERT_EQ(ZyanDequePushFront(&deque, &i), ZYAN_STATUS_SUCCESS);
+    }
+
+    // Moving an element out of the deque does not destroy it
+    g_freed_count = 0;
+    ZyanU64 element;
+    ASSERT_EQ(ZyanDequePopBack(&deque, &element), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(element, 0u);
+    EXPECT_EQ(g_freed_count, static_cast<ZyanUSize>(0));
+
+    ASSERT_EQ(ZyanDequePopBack(&deque, ZYAN_NULL), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanDequePopFront(&deque, ZYAN_NULL), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanDequePopFrontRange(&deque, ZYAN_NULL, 3), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(g_freed_count, static_cast<ZyanUSize>(5));
+    EXPECT_EQ(ZYAN_DEQUE_GET(ZyanU64, &deque, 0), 5u);
+
+    ASSERT_EQ(ZyanDequeDestroy(&deque), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(g_freed_count, static_cast<ZyanUSize>(9));
+}
+
+#endif // ZYAN_NO_LIBC
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
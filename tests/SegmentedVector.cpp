@@ -0,0 +1,198 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanSegmentedVector` implementation.
+ */
+
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/SegmentedVector.h>
+#include <Zycore/StatsAllocator.h>
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   The number of `ZyanU64` objects passed to `FreeZyanU64`.
+ */
+static ZyanUSize g_freed_count = 0;
+
+/**
+ * @brief   A dummy destructor for `ZyanU64` objects, that counts the destroyed objects.
+ *
+ * @param   object  A pointer to the object.
+ */
+static void FreeZyanU64(ZyanU64* object)
+{
+    ZYAN_UNUSED(object);
+    ++g_freed_count;
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+#ifndef ZYAN_NO_LIBC
+
+TEST(SegmentedVectorTest, InitBasic)
+{
+    ZyanSegmentedVector vector;
+    ASSERT_EQ(ZyanSegmentedVectorInit(&vector, sizeof(ZyanU64), 10,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(vector.size, static_cast<ZyanUSize>(0));
+    EXPECT_EQ(vector.capacity, static_cast<ZyanUSize>(0));
+    EXPECT_EQ(vector.element_size, sizeof(ZyanU64));
+    EXPECT_EQ(vector.block_shift, 4);
+    EXPECT_EQ(vector.block_count, 0);
+    EXPECT_EQ(ZyanSegmentedVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+
+    EXPECT_EQ(ZyanSegmentedVectorInit(&vector, 0, 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
+TEST(SegmentedVectorTest, StableAddresses)
+{
+    ZyanSegmentedVector vector;
+    ASSERT_EQ(ZyanSegmentedVectorInit(&vector, sizeof(ZyanU64), 4,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+
+    static const ZyanUSize count = 10000;
+    std::vector<const ZyanU64*> pointers;
+    for (ZyanU64 i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(ZyanSegmentedVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+        pointers.push_back(static_cast<const ZyanU64*>(ZyanSegmentedVectorGet(&vector, i)));
+    }
+
+    // Blocks of 4, 8, 16, ... elements
+    EXPECT_EQ(vector.size, count);
+    EXPECT_EQ(vector.block_count, 12);
+    EXPECT_EQ(vector.capacity, static_cast<ZyanUSize>(4 * ((1 << 12) - 1)));
+
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(ZyanSegmentedVectorGet(&vector, i), pointers[i]);
+        EXPECT_EQ(*pointers[i], i);
+        EXPECT_EQ(ZYAN_SEGMENTED_VECTOR_GET(ZyanU64, &vector, i), i);
+    }
+
+    const void* element;
+    EXPECT_EQ(ZyanSegmentedVectorGetPointer(&vector, count, &element), ZYAN_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(ZyanSegmentedVectorGet(&vector, count), ZYAN_NULL);
+
+    EXPECT_EQ(ZyanSegmentedVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(SegmentedVectorTest, Destructor)
+{
+    ZyanSegmentedVector vector;
+    ASSERT_EQ(ZyanSegmentedVectorInit(&vector, sizeof(ZyanU64), 0,
+        reinterpret_cast<ZyanMemberProcedure>(&FreeZyanU64)), ZYAN_STATUS_SUCCESS);
+
+    const ZyanU64 initializer = 1337;
+    ASSERT_EQ(ZyanSegmentedVectorResizeEx(&vector, 100, &initializer), ZYAN_STATUS_SUCCESS);
+    for (ZyanUSize i = 0; i < vector.size; ++i)
+    {
+        EXPECT_EQ(ZYAN_SEGMENTED_VECTOR_GET(ZyanU64, &vector, i), initializer);
+    }
+
+    g_freed_count = 0;
+    ASSERT_EQ(ZyanSegmentedVectorPopBack(&vector), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(g_freed_count, static_cast<ZyanUSize>(1));
+    ASSERT_EQ(ZyanSegmentedVectorSet(&vector, 0, &initializer), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(g_freed_count, static_cast<ZyanUSize>(2));
+    ASSERT_EQ(ZyanSegmentedVectorResize(&vector, 50), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(g_freed_count, static_cast<ZyanUSize>(51));
+    ASSERT_EQ(ZyanSegmentedVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(g_freed_count, static_cast<ZyanUSize>(101));
+}
+
+TEST(SegmentedVectorTest, ReserveAndShrink)
+{
+    ZyanStatsAllocator stats;
+    ASSERT_EQ(ZyanStatsAllocatorInit(&stats), ZYAN_STATUS_SUCCESS);
+
+    ZyanSegmentedVector vector;
+    ASSERT_EQ(ZyanSegmentedVectorInitEx(&vector, sizeof(ZyanU64), 16,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), &stats.allocator),
+        ZYAN_STATUS_SUCCESS);
+
+    // Blocks of 16, 32 and 64 elements
+    ASSERT_EQ(ZyanSegmentedVectorReserve(&vector, 100), ZYAN_STATUS_SUCCESS);
+    ZyanUSize capacity;
+    ASSERT_EQ(ZyanSegmentedVectorGetCapacity(&vector, &capacity), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(capacity, static_cast<ZyanUSize>(112));
+
+    // Nothing is relocated while the vector grows into the reserved blocks
+    ZyanStatsAllocatorSnapshot snapshot;
+    ASSERT_EQ(ZyanStatsAllocatorGetSnapshot(&stats, &snapshot), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(snapshot.allocations, 3u);
+    for (ZyanU64 i = 0; i < 100; ++i)
+    {
+        void* element;
+        ASSERT_EQ(ZyanSegmentedVectorEmplace(&vector, &element), ZYAN_STATUS_SUCCESS);
+        *static_cast<ZyanU64*>(element) = i;
+    }
+    ASSERT_EQ(ZyanStatsAllocatorGetSnapshot(&stats, &snapshot), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(snapshot.allocations, 3u);
+    EXPECT_EQ(snapshot.reallocations, 0u);
+
+    // Only empty blocks are released
+    ASSERT_EQ(ZyanSegmentedVectorResize(&vector, 48), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanSegmentedVectorShrinkToFit(&vector), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(vector.capacity, static_cast<ZyanUSize>(48));
+    ASSERT_EQ(ZyanSegmentedVectorResize(&vector, 47), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanSegmentedVectorShrinkToFit(&vector), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(vector.capacity, static_cast<ZyanUSize>(48));
+    for (ZyanU64 i = 0; i < 47; ++i)
+    {
+        EXPECT_EQ(ZYAN_SEGMENTED_VECTOR_GET(ZyanU64, &vector, i), i);
+    }
+
+    ASSERT_EQ(ZyanSegmentedVectorClear(&vector), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(vector.capacity, static_cast<ZyanUSize>(48));
+    ASSERT_EQ(ZyanSegmentedVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanStatsAllocatorGetSnapshot(&stats, &snapshot), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(snapshot.deallocations, 3u);
+    EXPECT_EQ(snapshot.live_bytes, 0u);
+}
+
+#endif // ZYAN_NO_LIBC
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,171 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : Florian Bernd
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanSoAVector` implementation.
+ */
+
+#include <gtest/gtest.h>
+#include <Zycore/SoAVector.h>
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * @brief   The field sizes of a record consisting of a `ZyanU64` address, a `ZyanU16` length and
+ *          a `ZyanU8` flag.
+ */
+static const ZyanUSize g_field_sizes[] = { sizeof(ZyanU64), sizeof(ZyanU16), sizeof(ZyanU8) };
+
+TEST(SoAVectorTest, InitBasic)
+{
+    ZyanSoAVector vector;
+    ASSERT_EQ(ZyanSoAVectorInit(&vector, g_field_sizes, ZYAN_ARRAY_LENGTH(g_field_sizes), 10),
+        ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(vector.size, static_cast<ZyanUSize>(0));
+    EXPECT_EQ(vector.capacity, static_cast<ZyanUSize>(10));
+    EXPECT_EQ(vector.field_count, ZYAN_ARRAY_LENGTH(g_field_sizes));
+    for (ZyanUSize i = 0; i < vector.field_count; ++i)
+    {
+        EXPECT_EQ(reinterpret_cast<ZyanUPointer>(ZyanSoAVectorGetColumn(&vector, i)) %
+            ZYAN_SOA_VECTOR_COLUMN_ALIGNMENT, 0u);
+    }
+    EXPECT_EQ(ZyanSoAVectorGetColumn(&vector, vector.field_count), ZYAN_NULL);
+    EXPECT_EQ(ZyanSoAVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+
+    // Edge cases
+    const ZyanUSize invalid_sizes[] = { 1, 0 };
+    EXPECT_EQ(ZyanSoAVectorInit(&vector, invalid_sizes, ZYAN_ARRAY_LENGTH(invalid_sizes), 0),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanSoAVectorInit(&vector, g_field_sizes, 0, 0), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanSoAVectorInit(&vector, g_field_sizes, ZYAN_SOA_VECTOR_MAX_FIELDS + 1, 0),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
+TEST(SoAVectorTest, PushBackAndColumns)
+{
+    ZyanSoAVector vector;
+    ASSERT_EQ(ZyanSoAVectorInit(&vector, g_field_sizes, ZYAN_ARRAY_LENGTH(g_field_sizes), 0),
+        ZYAN_STATUS_SUCCESS);
+
+    static const ZyanUSize count = 1000;
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        const ZyanU64 address = 0x401000 + i * 4;
+        const ZyanU16 length = static_cast<ZyanU16>(i % 15 + 1);
+        const ZyanU8 flag = static_cast<ZyanU8>(i & 1);
+        const void* const fields[] = { &address, &length, (i % 3) ? &flag : ZYAN_NULL };
+        ASSERT_EQ(ZyanSoAVectorPushBack(&vector, fields), ZYAN_STATUS_SUCCESS);
+    }
+    EXPECT_EQ(vector.size, count);
+
+    // Every column is a dense array
+    const ZyanU64* const addresses = static_cast<const ZyanU64*>(
+        ZyanSoAVectorGetColumn(&vector, 0));
+    const ZyanU16* const lengths = static_cast<const ZyanU16*>(
+        ZyanSoAVectorGetColumn(&vector, 1));
+    const ZyanU8* const flags = static_cast<const ZyanU8*>(ZyanSoAVectorGetColumn(&vector, 2));
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(addresses[i], 0x401000 + i * 4);
+        EXPECT_EQ(lengths[i], i % 15 + 1);
+        EXPECT_EQ(flags[i], (i % 3) ? (i & 1) : 0);
+        EXPECT_EQ(ZYAN_SOA_VECTOR_GET(ZyanU16, &vector, i, 1), lengths[i]);
+    }
+
+    ZyanU64 address = 0;
+    ZyanU8 flag = 0;
+    void* const record[] = { &address, ZYAN_NULL, &flag };
+    ASSERT_EQ(ZyanSoAVectorGetRecord(&vector, 5, record), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(address, 0x401000u + 5 * 4);
+    EXPECT_EQ(flag, 1);
+    EXPECT_EQ(ZyanSoAVectorGetRecord(&vector, count, record), ZYAN_STATUS_OUT_OF_RANGE);
+
+    const ZyanU16 length = 1337;
+    const void* const update[] = { ZYAN_NULL, &length, ZYAN_NULL };
+    ASSERT_EQ(ZyanSoAVectorSet(&vector, 5, update), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZYAN_SOA_VECTOR_GET(ZyanU64, &vector, 5, 0), 0x401000u + 5 * 4);
+    EXPECT_EQ(ZYAN_SOA_VECTOR_GET(ZyanU16, &vector, 5, 1), 1337);
+
+    EXPECT_EQ(ZyanSoAVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(SoAVectorTest, Resize)
+{
+    ZyanSoAVector vector;
+    ASSERT_EQ(ZyanSoAVectorInit(&vector, g_field_sizes, ZYAN_ARRAY_LENGTH(g_field_sizes), 4),
+        ZYAN_STATUS_SUCCESS);
+
+    void* fields[ZYAN_ARRAY_LENGTH(g_field_sizes)];
+    for (ZyanUSize i = 0; i < 4; ++i)
+    {
+        ASSERT_EQ(ZyanSoAVectorEmplace(&vector, fields), ZYAN_STATUS_SUCCESS);
+        *static_cast<ZyanU64*>(fields[0]) = i;
+        *static_cast<ZyanU16*>(fields[1]) = static_cast<ZyanU16>(i);
+        *static_cast<ZyanU8*>(fields[2]) = static_cast<ZyanU8>(i);
+    }
+
+    // New records are zero-initialized and existing ones are retained
+    ASSERT_EQ(ZyanSoAVectorResize(&vector, 100), ZYAN_STATUS_SUCCESS);
+    ZyanUSize capacity;
+    ASSERT_EQ(ZyanSoAVectorGetCapacity(&vector, &capacity), ZYAN_STATUS_SUCCESS);
+    EXPECT_GE(capacity, static_cast<ZyanUSize>(100));
+    for (ZyanUSize i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(ZYAN_SOA_VECTOR_GET(ZyanU64, &vector, i, 0), (i < 4) ? i : 0);
+        EXPECT_EQ(ZYAN_SOA_VECTOR_GET(ZyanU16, &vector, i, 1), (i < 4) ? i : 0);
+        EXPECT_EQ(ZYAN_SOA_VECTOR_GET(ZyanU8, &vector, i, 2), (i < 4) ? i : 0);
+    }
+
+    ASSERT_EQ(ZyanSoAVectorResize(&vector, 3), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanSoAVectorPopBack(&vector), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanSoAVectorShrinkToFit(&vector), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(vector.capacity, static_cast<ZyanUSize>(2));
+    EXPECT_EQ(ZYAN_SOA_VECTOR_GET(ZyanU64, &vector, 1, 0), 1u);
+    EXPECT_EQ(ZyanSoAVectorGet(&vector, 2, 0), ZYAN_NULL);
+
+    ASSERT_EQ(ZyanSoAVectorClear(&vector), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanSoAVectorPopBack(&vector), ZYAN_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(ZyanSoAVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+#endif // ZYAN_NO_LIBC
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
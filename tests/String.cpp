@@ -33,6 +33,7 @@
 #include <Zycore/Allocator.h>
 #include <Zycore/Defines.h>
 #include <Zycore/LibC.h>
+#include <Zycore/StatsAllocator.h>
 #include <Zycore/String.h>
 #include <Zycore/Types.h>
 
@@ -157,6 +158,46 @@ TEST(StringTest, InitAdvanced)
     EXPECT_EQ(ZyanStringDestroy(&string), ZYAN_STATUS_SUCCESS);
 }
 
+TEST(StringTest, InitSmall)
+{
+    ZyanStatsAllocator stats;
+    ASSERT_EQ(ZyanStatsAllocatorInit(&stats), ZYAN_STATUS_SUCCESS);
+
+    ZyanSmallString small;
+    ASSERT_EQ(ZyanStringInitSmallEx(&small, &stats.allocator, 2, 0), ZYAN_STATUS_SUCCESS);
+    ZyanString* const string = &small.string;
+    EXPECT_EQ(string->vector.data, small.buffer);
+    EXPECT_EQ(string->vector.capacity, static_cast<ZyanUSize>(ZYAN_SMALL_STRING_CAPACITY));
+
+    // Short contents never touch the allocator
+    ZyanStringView mnemonic;
+    ASSERT_EQ(ZyanStringViewInsideBuffer(&mnemonic, "vpbroadcastq"), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanStringAppend(string, &mnemonic), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanStringAppend(string, &mnemonic), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(string->vector.data, small.buffer);
+    ZyanStatsAllocatorSnapshot snapshot;
+    ASSERT_EQ(ZyanStatsAllocatorGetSnapshot(&stats, &snapshot), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(snapshot.allocations, 0u);
+
+    // Growing past the inline buffer spills to the allocator
+    ASSERT_EQ(ZyanStringAppend(string, &mnemonic), ZYAN_STATUS_SUCCESS);
+    EXPECT_NE(string->vector.data, small.buffer);
+    ASSERT_EQ(ZyanStatsAllocatorGetSnapshot(&stats, &snapshot), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(snapshot.allocations, 1u);
+
+    const char* data;
+    ASSERT_EQ(ZyanStringGetData(string, &data), ZYAN_STATUS_SUCCESS);
+    EXPECT_STREQ(data, "vpbroadcastqvpbroadcastqvpbroadcastq");
+    ZyanUSize size;
+    ASSERT_EQ(ZyanStringViewGetSize(ZYAN_STRING_TO_VIEW(string), &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, 36u);
+
+    EXPECT_EQ(ZyanStringDestroy(string), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanStatsAllocatorGetSnapshot(&stats, &snapshot), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(snapshot.deallocations, 1u);
+    EXPECT_EQ(snapshot.live_bytes, 0u);
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
@@ -29,9 +29,13 @@
  * @brief   Tests the `ZyanVector` implementation.
  */
 
+#include <algorithm>
+#include <cstddef>
 #include <time.h>
+#include <vector>
 #include <gtest/gtest.h>
 #include <Zycore/Comparison.h>
+#include <Zycore/StatsAllocator.h>
 #include <Zycore/Vector.h>
 
 /* ============================================================================================== */
@@ -134,6 +138,39 @@ static void FreeZyanU16(ZyanU16* object)
     *object = 0;
 }
 
+/**
+ * @brief   The sum of all `ZyanU64` objects passed to `FreeZyanU64`.
+ */
+static ZyanU64 g_freed_sum = 0;
+
+/**
+ * @brief   A dummy destructor for `ZyanU64` objects, that sums up the destroyed values.
+ *
+ * @param   object  A pointer to the object.
+ */
+static void FreeZyanU64(ZyanU64* object)
+{
+    g_freed_sum += *object;
+}
+
+/**
+ * @brief   Checks, if a `ZyanU64` object is a multiple of the given divisor.
+ *
+ * @param   object  A pointer to the object.
+ * @param   divisor A pointer to the divisor.
+ *
+ * @return  `ZYAN_TRUE`, if the object is a multiple of the divisor or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool IsMultipleOf(const ZyanU64* object, const ZyanU64* divisor)
+{
+    return !(*object % *divisor);
+}
+
+/**
+ * @brief   Declares the typed vector functions for `ZyanU64` elements.
+ */
+ZYAN_DECLARE_TYPED_VECTOR(VectorU64, ZyanU64)
+
 /* ============================================================================================== */
 /* Tests                                                                                          */
 /* ============================================================================================== */
@@ -282,6 +319,428 @@ TEST(VectorTest, TestGrowingAndShrinking)
     EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
 }
 
+TEST(VectorTest, GrowthPolicy)
+{
+    ZyanVectorGrowthPolicy policy;
+    ASSERT_EQ(ZyanVectorGrowthPolicyInit(&policy), ZYAN_STATUS_SUCCESS);
+    policy.page_size        = 0;
+    policy.shrink_threshold = 2;
+    policy.shrink_delay     = 4;
+
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU64), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanVectorSetGrowthPolicy(&vector, &policy), ZYAN_STATUS_SUCCESS);
+
+    // The vector grows by a factor of 1.5
+    for (ZyanU64 i = 0; i < 100; ++i)
+    {
+        ZyanUSize expected_capacity = vector.capacity;
+        if (expected_capacity < (i + 1))
+        {
+            expected_capacity = (i + 1) + (i + 2) / 2;
+        }
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(vector.capacity, expected_capacity);
+    }
+
+    // The vector only shrinks after `shrink_delay` consecutive under-occupied removals
+    while (vector.size * 2 >= vector.capacity)
+    {
+        ASSERT_EQ(ZyanVectorPopBack(&vector), ZYAN_STATUS_SUCCESS);
+    }
+    const ZyanUSize capacity = vector.capacity;
+    // The last removal of the loop above already counts towards the delay
+    for (ZyanU8 i = 2; i < policy.shrink_delay; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPopBack(&vector), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(vector.capacity, capacity);
+    }
+    ASSERT_EQ(ZyanVectorPopBack(&vector), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(vector.capacity, vector.size + (vector.size + 1) / 2);
+
+    // A single growth step is limited to `max_growth_step` bytes
+    policy.max_growth_step = 16 * sizeof(ZyanU64);
+    for (ZyanU64 i = vector.size; i < 1000; ++i)
+    {
+        const ZyanUSize previous_capacity = vector.capacity;
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+        if (vector.capacity != previous_capacity)
+        {
+            ASSERT_EQ(vector.capacity - vector.size, 16u);
+        }
+    }
+
+    // Large buffers are rounded to whole pages
+    policy.max_growth_step = 0;
+    policy.page_size       = 4096;
+    policy.page_threshold  = 8192;
+    for (ZyanU64 i = vector.size; i < 5000; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+    }
+    EXPECT_EQ((vector.capacity * sizeof(ZyanU64)) % 4096, 0u);
+    for (ZyanU64 i = 0; i < 5000; ++i)
+    {
+        ASSERT_EQ(ZYAN_VECTOR_GET(ZyanU64, &vector, i), i);
+    }
+
+    // Growth factors below `1` and page sizes that are no power of two are rejected
+    policy.growth_numerator = 1;
+    EXPECT_EQ(ZyanVectorSetGrowthPolicy(&vector, &policy), ZYAN_STATUS_INVALID_ARGUMENT);
+    policy.growth_numerator = 3;
+    policy.page_size        = 3000;
+    EXPECT_EQ(ZyanVectorSetGrowthPolicy(&vector, &policy), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanVectorSetGrowthPolicy(&vector,
+        static_cast<const ZyanVectorGrowthPolicy*>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(VectorTest, GrowthPolicyResize)
+{
+    ZyanVectorGrowthPolicy policy;
+    ASSERT_EQ(ZyanVectorGrowthPolicyInit(&policy), ZYAN_STATUS_SUCCESS);
+    policy.page_size        = 0;
+    policy.shrink_threshold = 2;
+    policy.shrink_delay     = 4;
+
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU64), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanVectorSetGrowthPolicy(&vector, &policy), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanVectorReserve(&vector, 1000), ZYAN_STATUS_SUCCESS);
+    const ZyanUSize capacity = vector.capacity;
+
+    // Growing resizes below the shrink threshold never count towards the shrink delay
+    for (ZyanUSize size = 1; size <= 4 * policy.shrink_delay; ++size)
+    {
+        ASSERT_EQ(ZyanVectorResize(&vector, size), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(vector.capacity, capacity);
+    }
+
+    // Shrinking resizes still do
+    for (ZyanU8 i = 1; i < policy.shrink_delay; ++i)
+    {
+        ASSERT_EQ(ZyanVectorResize(&vector, vector.size - 1), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(vector.capacity, capacity);
+    }
+    ASSERT_EQ(ZyanVectorResize(&vector, vector.size - 1), ZYAN_STATUS_SUCCESS);
+    EXPECT_LT(vector.capacity, capacity);
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(VectorTest, SortPatterns)
+{
+    constexpr ZyanUSize size = 10000;
+
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU64), size,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+
+    // Ascending, descending, organ pipe, sawtooth, all equal and random inputs
+    for (ZyanUSize pattern = 0; pattern < 6; ++pattern)
+    {
+        ASSERT_EQ(ZyanVectorClear(&vector), ZYAN_STATUS_SUCCESS);
+        for (ZyanUSize i = 0; i < size; ++i)
+        {
+            const ZyanU64 values[] =
+            {
+                i, size - i, ZYAN_MIN(i, size - i), i % 64, 42, static_cast<ZyanU64>(rand())
+            };
+            ASSERT_EQ(ZyanVectorPushBack(&vector, &values[pattern]), ZYAN_STATUS_SUCCESS);
+        }
+
+        ASSERT_EQ(ZyanVectorSort(&vector,
+            reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64)), ZYAN_STATUS_SUCCESS);
+        for (ZyanUSize i = 1; i < size; ++i)
+        {
+            ASSERT_GE(ZYAN_VECTOR_GET(ZyanU64, &vector, i),
+                ZYAN_VECTOR_GET(ZyanU64, &vector, i - 1));
+        }
+    }
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(VectorTest, SortParallel)
+{
+    constexpr ZyanUSize size = 100000;
+
+    ZyanStatsAllocator stats;
+    ASSERT_EQ(ZyanStatsAllocatorInit(&stats), ZYAN_STATUS_SUCCESS);
+
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU64), size,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+
+    // Two, three (odd number of merge passes), five (uneven runs) and one thread per processor
+    for (const ZyanUSize thread_count : { 2, 3, 5, 0 })
+    {
+        ASSERT_EQ(ZyanVectorClear(&vector), ZYAN_STATUS_SUCCESS);
+        ZyanU64 sum = 0;
+        for (ZyanUSize i = 0; i < size; ++i)
+        {
+            const ZyanU64 element = static_cast<ZyanU64>(rand() % 10000);
+            sum += element;
+            ASSERT_EQ(ZyanVectorPushBack(&vector, &element), ZYAN_STATUS_SUCCESS);
+        }
+
+        ASSERT_EQ(ZyanVectorSortParallel(&vector,
+            reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64), thread_count,
+            &stats.allocator), ZYAN_STATUS_SUCCESS);
+        ZyanU64 sorted_sum = ZYAN_VECTOR_GET(ZyanU64, &vector, 0);
+        for (ZyanUSize i = 1; i < size; ++i)
+        {
+            ASSERT_GE(ZYAN_VECTOR_GET(ZyanU64, &vector, i),
+                ZYAN_VECTOR_GET(ZyanU64, &vector, i - 1));
+            sorted_sum += ZYAN_VECTOR_GET(ZyanU64, &vector, i);
+        }
+        EXPECT_EQ(sorted_sum, sum);
+    }
+
+    ZyanStatsAllocatorSnapshot snapshot;
+    ASSERT_EQ(ZyanStatsAllocatorGetSnapshot(&stats, &snapshot), ZYAN_STATUS_SUCCESS);
+    EXPECT_GE(snapshot.allocations, 3u);
+    EXPECT_EQ(snapshot.live_bytes, 0u);
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(VectorTest, RemoveIfDestructor)
+{
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU64), 0,
+        reinterpret_cast<ZyanMemberProcedure>(&FreeZyanU64)), ZYAN_STATUS_SUCCESS);
+
+    // Runs of removed and retained elements of different lengths at both ends of the vector
+    ZyanU64 expected_sum = 0;
+    std::vector<ZyanU64> expected;
+    for (ZyanU64 i = 0; i < 1000; ++i)
+    {
+        const ZyanU64 element = (i % 7 < 3) ? i * 2 : i * 2 + 1;
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &element), ZYAN_STATUS_SUCCESS);
+        if (element % 2)
+        {
+            expected.push_back(element);
+        } else
+        {
+            expected_sum += element;
+        }
+    }
+
+    g_freed_sum = 0;
+    ZyanU64 divisor = 2;
+    ASSERT_EQ(ZyanVectorRemoveIf(&vector,
+        reinterpret_cast<ZyanVectorPredicate>(&IsMultipleOf), &divisor), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(g_freed_sum, expected_sum);
+    ASSERT_EQ(vector.size, expected.size());
+    for (ZyanUSize i = 0; i < vector.size; ++i)
+    {
+        EXPECT_EQ(ZYAN_VECTOR_GET(ZyanU64, &vector, i), expected[i]);
+    }
+
+    // The vector shrinks once the removal is complete
+    EXPECT_LE(vector.capacity, vector.size * vector.shrink_threshold);
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(VectorTest, FindBytesElementSizes)
+{
+    static const ZyanUSize element_sizes[] = { 1, 2, 3, 4, 8, 16 };
+    static const ZyanUSize count = 100;
+
+    for (const ZyanUSize element_size : element_sizes)
+    {
+        // Every byte of the element at index `i` has the value `i`
+        ZyanVector vector;
+        ASSERT_EQ(ZyanVectorInit(&vector, element_size, count,
+            reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+        std::vector<ZyanU8> element(element_size);
+        for (ZyanUSize i = 0; i < count; ++i)
+        {
+            std::fill(element.begin(), element.end(), static_cast<ZyanU8>(i));
+            ASSERT_EQ(ZyanVectorPushBack(&vector, element.data()), ZYAN_STATUS_SUCCESS);
+        }
+
+        for (ZyanUSize i = 0; i < count; ++i)
+        {
+            ZyanISize index;
+            std::fill(element.begin(), element.end(), static_cast<ZyanU8>(i));
+            for (ZyanUSize start = 0; start < 40; start += 13)
+            {
+                const ZyanStatus expected_status = (i >= start) ? ZYAN_STATUS_TRUE :
+                    ZYAN_STATUS_FALSE;
+                EXPECT_EQ(ZyanVectorFindBytesEx(&vector, element.data(), &index, start,
+                    count - start), expected_status);
+                EXPECT_EQ(index, (i >= start) ? static_cast<ZyanISize>(i) : -1);
+            }
+
+            // Elements that only partially match must not be found
+            if (element_size > 1)
+            {
+                element.back() = static_cast<ZyanU8>(i + 1);
+                EXPECT_EQ(ZyanVectorFindBytes(&vector, element.data(), &index),
+                    ZYAN_STATUS_FALSE);
+                EXPECT_EQ(index, -1);
+            }
+        }
+
+        EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+TEST(VectorTest, SortByKey)
+{
+    struct Element
+    {
+        ZyanU32 index;
+        ZyanU64 address;
+    };
+    constexpr ZyanUSize size = 10000;
+
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInit(&vector, sizeof(Element), size,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+    for (ZyanU32 i = 0; i < size; ++i)
+    {
+        // Few distinct keys with equal high bytes, to exercise stability and skipped passes
+        const Element element = { i, 0x7FFF00000000ULL + static_cast<ZyanU64>(rand() % 1000) * 16 };
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &element), ZYAN_STATUS_SUCCESS);
+    }
+
+    ASSERT_EQ(ZyanVectorSortByKey(&vector, offsetof(Element, address), sizeof(ZyanU64)),
+        ZYAN_STATUS_SUCCESS);
+    for (ZyanUSize i = 1; i < size; ++i)
+    {
+        const Element& previous = ZYAN_VECTOR_GET(Element, &vector, i - 1);
+        const Element& current = ZYAN_VECTOR_GET(Element, &vector, i);
+        ASSERT_GE(current.address, previous.address);
+        if (current.address == previous.address)
+        {
+            ASSERT_GT(current.index, previous.index);
+        }
+    }
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(VectorTest, InitAligned)
+{
+    ZyanVector vector;
+
+    EXPECT_EQ(ZyanVectorInitAligned(&vector, sizeof(ZyanU8), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), 48), ZYAN_STATUS_INVALID_ARGUMENT);
+    ASSERT_EQ(ZyanVectorInitAligned(&vector, sizeof(ZyanU8), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), 64), ZYAN_STATUS_SUCCESS);
+
+    for (ZyanUSize i = 0; i < 10000; ++i)
+    {
+        const auto value = static_cast<ZyanU8>(i);
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &value), ZYAN_STATUS_SUCCESS);
+        ASSERT_TRUE(ZYAN_IS_ALIGNED_TO(reinterpret_cast<ZyanUPointer>(vector.data), 64));
+    }
+    while (vector.size > 1)
+    {
+        ASSERT_EQ(ZyanVectorPopBack(&vector), ZYAN_STATUS_SUCCESS);
+        ASSERT_TRUE(ZYAN_IS_ALIGNED_TO(reinterpret_cast<ZyanUPointer>(vector.data), 64));
+        ASSERT_EQ(ZYAN_VECTOR_GET(ZyanU8, &vector, vector.size - 1),
+            static_cast<ZyanU8>(vector.size - 1));
+    }
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(VectorTest, InitSmall)
+{
+    ZyanStatsAllocator stats;
+    ASSERT_EQ(ZyanStatsAllocatorInit(&stats), ZYAN_STATUS_SUCCESS);
+
+    ZyanU64 buffer[8];
+    ZyanSmallVector small;
+    ASSERT_EQ(ZyanVectorInitSmallEx(&small, sizeof(ZyanU64), buffer, ZYAN_ARRAY_LENGTH(buffer),
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), &stats.allocator, 2, 0),
+        ZYAN_STATUS_SUCCESS);
+    ZyanVector* const vector = &small.vector;
+    EXPECT_EQ(vector->data, buffer);
+
+    // Filling the inline buffer never touches the allocator
+    for (ZyanU64 i = 0; i < ZYAN_ARRAY_LENGTH(buffer); ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(vector, &i), ZYAN_STATUS_SUCCESS);
+    }
+    EXPECT_EQ(vector->data, buffer);
+    ZyanStatsAllocatorSnapshot snapshot;
+    ASSERT_EQ(ZyanStatsAllocatorGetSnapshot(&stats, &snapshot), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(snapshot.allocations, 0u);
+
+    // Overflowing migrates the elements instead of failing
+    for (ZyanU64 i = ZYAN_ARRAY_LENGTH(buffer); i < 100; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(vector, &i), ZYAN_STATUS_SUCCESS);
+    }
+    EXPECT_NE(vector->data, buffer);
+    ASSERT_EQ(ZyanStatsAllocatorGetSnapshot(&stats, &snapshot), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(snapshot.allocations, 1u);
+    for (ZyanU64 i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(ZYAN_VECTOR_GET(ZyanU64, vector, i), i);
+    }
+
+    EXPECT_EQ(ZyanVectorDestroy(vector), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanStatsAllocatorGetSnapshot(&stats, &snapshot), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(snapshot.live_bytes, 0u);
+}
+
+TEST(VectorTest, InitVirtual)
+{
+    ZyanVector vector;
+
+    constexpr ZyanUSize max_capacity = 20000;
+    EXPECT_EQ(ZyanVectorInitVirtual(&vector, sizeof(ZyanU64), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_INVALID_ARGUMENT);
+    ASSERT_EQ(ZyanVectorInitVirtual(&vector, sizeof(ZyanU64), max_capacity,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+    EXPECT_GE(vector.capacity, static_cast<ZyanUSize>(1));
+
+    ZyanU64 value = 0;
+    ASSERT_EQ(ZyanVectorPushBack(&vector, &value), ZYAN_STATUS_SUCCESS);
+    const void* const data = vector.data;
+    const void* const first = ZyanVectorGet(&vector, 0);
+
+    ZyanStatus status;
+    do
+    {
+        ++value;
+        status = ZyanVectorPushBack(&vector, &value);
+    } while (ZYAN_SUCCESS(status));
+    EXPECT_EQ(status, ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+    EXPECT_EQ(vector.size, max_capacity);
+    EXPECT_EQ(vector.capacity, max_capacity);
+    EXPECT_EQ(ZyanVectorReserve(&vector, max_capacity + 1),
+        ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+
+    // Growing never moves the data
+    EXPECT_EQ(vector.data, data);
+    EXPECT_EQ(ZyanVectorGet(&vector, 0), first);
+    for (ZyanUSize i = 0; i < vector.size; ++i)
+    {
+        ASSERT_EQ(ZYAN_VECTOR_GET(ZyanU64, &vector, i), i);
+    }
+
+    const ZyanUSize capacity = vector.capacity;
+    ASSERT_EQ(ZyanVectorResize(&vector, 10), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanVectorShrinkToFit(&vector), ZYAN_STATUS_SUCCESS);
+    EXPECT_LT(vector.capacity, capacity);
+    EXPECT_GE(vector.capacity, static_cast<ZyanUSize>(10));
+    EXPECT_EQ(vector.data, data);
+    EXPECT_EQ(ZYAN_VECTOR_GET(ZyanU64, &vector, 9), 9u);
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
 TEST_P(VectorTestFilled, ElementAccess)
 {
     static const ZyanU64 element_in = 1337;
@@ -406,6 +865,50 @@ TEST_P(VectorTestFilled, Delete)
     }
 }
 
+TEST_P(VectorTestFilled, DeleteUnordered)
+{
+    EXPECT_EQ(ZyanVectorDeleteUnordered(&m_vector, m_vector.size), ZYAN_STATUS_OUT_OF_RANGE);
+
+    const ZyanUSize size = m_vector.size;
+    EXPECT_EQ(ZyanVectorDeleteUnordered(&m_vector, 1), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(m_vector.size, size - 1);
+    EXPECT_EQ(ZYAN_VECTOR_GET(ZyanU64, &m_vector, 0), 0u);
+    EXPECT_EQ(ZYAN_VECTOR_GET(ZyanU64, &m_vector, 1), size - 1);
+    EXPECT_EQ(ZYAN_VECTOR_GET(ZyanU64, &m_vector, 2), 2u);
+
+    EXPECT_EQ(ZyanVectorDeleteUnordered(&m_vector, m_vector.size - 1), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(m_vector.size, size - 2);
+    EXPECT_EQ(ZYAN_VECTOR_GET(ZyanU64, &m_vector, m_vector.size - 1), size - 3);
+}
+
+TEST_P(VectorTestFilled, RemoveIf)
+{
+    const ZyanUSize size = m_vector.size;
+    ZyanU64 divisor = 3;
+    EXPECT_EQ(ZyanVectorRemoveIf(&m_vector,
+        reinterpret_cast<ZyanVectorPredicate>(&IsMultipleOf), &divisor), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(m_vector.size, size - (size + 2) / 3);
+    for (ZyanUSize i = 0; i < m_vector.size; ++i)
+    {
+        EXPECT_EQ(ZYAN_VECTOR_GET(ZyanU64, &m_vector, i), i + i / 2 + 1);
+    }
+
+    // Nothing to remove
+    const ZyanUSize remaining = m_vector.size;
+    EXPECT_EQ(ZyanVectorRemoveIf(&m_vector,
+        reinterpret_cast<ZyanVectorPredicate>(&IsMultipleOf), &divisor), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(m_vector.size, remaining);
+
+    // Everything to remove
+    divisor = 1;
+    EXPECT_EQ(ZyanVectorRemoveIf(&m_vector,
+        reinterpret_cast<ZyanVectorPredicate>(&IsMultipleOf), &divisor), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(m_vector.size, static_cast<ZyanUSize>(0));
+
+    EXPECT_EQ(ZyanVectorRemoveIf(&m_vector, reinterpret_cast<ZyanVectorPredicate>(ZYAN_NULL),
+        &divisor), ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
 TEST_P(VectorTestFilled, Find)
 {
     ZyanISize index;
@@ -431,6 +934,30 @@ TEST_P(VectorTestFilled, Find)
         ZYAN_STATUS_OUT_OF_RANGE);
 }
 
+TEST_P(VectorTestFilled, FindBytes)
+{
+    ZyanISize index;
+    for (ZyanU64 i = 0; i < m_vector.size; ++i)
+    {
+        EXPECT_EQ(ZyanVectorFindBytes(&m_vector, &i, &index), ZYAN_STATUS_TRUE);
+        EXPECT_EQ(static_cast<ZyanU64>(index), i);
+    }
+
+    ZyanU64 element_in = 1337;
+    EXPECT_EQ(ZyanVectorFindBytes(&m_vector, &element_in, &index), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(index, -1);
+
+    // Edge cases
+    element_in = 0;
+    EXPECT_EQ(ZyanVectorFindBytesEx(&m_vector, &element_in, &index, 1, m_vector.size - 1),
+        ZYAN_STATUS_FALSE);
+    EXPECT_EQ(ZyanVectorFindBytesEx(&m_vector, &element_in, &index, 0, 0), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(ZyanVectorFindBytesEx(&m_vector, &element_in, &index, 0, m_vector.size + 1),
+        ZYAN_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(ZyanVectorFindBytesEx(&m_vector, &element_in, &index, 1, m_vector.size),
+        ZYAN_STATUS_OUT_OF_RANGE);
+}
+
 TEST_P(VectorTestBase, BinarySearch)
 {
     EXPECT_EQ(ZyanVectorReserve(&m_vector, 100), ZYAN_STATUS_SUCCESS);
@@ -465,6 +992,146 @@ TEST_P(VectorTestBase, BinarySearch)
         ZYAN_STATUS_OUT_OF_RANGE);
 }
 
+TEST_P(VectorTestBase, Sort)
+{
+    ZyanU64 sum = 0;
+    for (ZyanUSize i = 0; i < m_test_size; ++i)
+    {
+        const ZyanU64 element = rand() % 50;
+        sum += element;
+        EXPECT_EQ(ZyanVectorPushBack(&m_vector, &element), ZYAN_STATUS_SUCCESS);
+    }
+
+    EXPECT_EQ(ZyanVectorSort(&m_vector, reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64)),
+        ZYAN_STATUS_SUCCESS);
+    ZyanU64 sorted_sum = ZYAN_VECTOR_GET(ZyanU64, &m_vector, 0);
+    for (ZyanUSize i = 1; i < m_vector.size; ++i)
+    {
+        EXPECT_GE(ZYAN_VECTOR_GET(ZyanU64, &m_vector, i),
+            ZYAN_VECTOR_GET(ZyanU64, &m_vector, i - 1));
+        sorted_sum += ZYAN_VECTOR_GET(ZyanU64, &m_vector, i);
+    }
+    EXPECT_EQ(sorted_sum, sum);
+
+    // Reverse the order by sorting by the inverted low byte
+    for (ZyanUSize i = 0; i < m_vector.size; ++i)
+    {
+        ZyanU64* const element = static_cast<ZyanU64*>(ZyanVectorGetMutable(&m_vector, i));
+        *element = (*element & ~0xFFULL) | (0xFF - (*element & 0xFF));
+    }
+    EXPECT_EQ(ZyanVectorSortByKey(&m_vector, 0, 1), ZYAN_STATUS_SUCCESS);
+    for (ZyanUSize i = 1; i < m_vector.size; ++i)
+    {
+        EXPECT_GE(ZYAN_VECTOR_GET(ZyanU64, &m_vector, i) & 0xFF,
+            ZYAN_VECTOR_GET(ZyanU64, &m_vector, i - 1) & 0xFF);
+    }
+
+    // Edge cases
+    EXPECT_EQ(ZyanVectorSortByKey(&m_vector, 0, 3), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanVectorSortByKey(&m_vector, 4, 8), ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
+TEST_P(VectorTestFilled, BinarySearchBranchless)
+{
+    // Add a few duplicates to verify that the first occurrence is found
+    const ZyanU64 duplicate = m_vector.size / 2;
+    EXPECT_EQ(ZyanVectorSet(&m_vector, duplicate + 1, &duplicate), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanVectorSet(&m_vector, duplicate + 2, &duplicate), ZYAN_STATUS_SUCCESS);
+
+    for (ZyanU64 i = 0; i < m_vector.size + 2; ++i)
+    {
+        ZyanUSize expected_index;
+        ZyanUSize index;
+        const ZyanStatus expected_status = ZyanVectorBinarySearch(&m_vector, &i, &expected_index,
+            reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64));
+        EXPECT_EQ(ZyanVectorBinarySearchBranchless(&m_vector, &i, &index,
+            reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64)), expected_status);
+        EXPECT_EQ(index, expected_index);
+    }
+
+    // Edge cases
+    const ZyanU64 element_in = 1337;
+    ZyanUSize index;
+    EXPECT_EQ(ZyanVectorBinarySearchBranchlessEx(&m_vector, &element_in, &index,
+        reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64), 1, 0), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(index, static_cast<ZyanUSize>(1));
+    EXPECT_EQ(ZyanVectorBinarySearchBranchlessEx(&m_vector, &element_in, &index,
+        reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64), 1, m_vector.size),
+        ZYAN_STATUS_OUT_OF_RANGE);
+}
+
+TEST_P(VectorTestFilled, BinarySearchBatch)
+{
+    // Use only even numbers to test lookups of missing elements as well
+    for (ZyanUSize i = 0; i < m_vector.size; ++i)
+    {
+        *static_cast<ZyanU64*>(ZyanVectorGetMutable(&m_vector, i)) = i * 2;
+    }
+
+    const ZyanUSize key_count = m_vector.size * 2 + 3;
+    std::vector<ZyanU64> sorted_keys(key_count);
+    for (ZyanUSize i = 0; i < key_count; ++i)
+    {
+        sorted_keys[i] = i;
+    }
+    std::vector<ZyanU64> unsorted_keys(sorted_keys.rbegin(), sorted_keys.rend());
+    std::swap(unsorted_keys[0], unsorted_keys[key_count / 2]);
+
+    for (const std::vector<ZyanU64>* keys : { &sorted_keys, &unsorted_keys })
+    {
+        std::vector<ZyanUSize> indices(key_count);
+        ASSERT_EQ(ZyanVectorBinarySearchBatch(&m_vector, keys->data(), key_count, indices.data(),
+            reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64)), ZYAN_STATUS_SUCCESS);
+        for (ZyanUSize i = 0; i < key_count; ++i)
+        {
+            ZyanUSize expected_index;
+            ZYAN_UNUSED(ZyanVectorBinarySearch(&m_vector, &(*keys)[i], &expected_index,
+                reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64)));
+            EXPECT_EQ(indices[i], expected_index);
+        }
+    }
+
+    // Edge cases
+    ZyanUSize* const no_indices = static_cast<ZyanUSize*>(ZYAN_NULL);
+    EXPECT_EQ(ZyanVectorBinarySearchBatch(&m_vector, ZYAN_NULL, 0, no_indices,
+        reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64)), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanVectorBinarySearchBatch(&m_vector, sorted_keys.data(), 1, no_indices,
+        reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64)), ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
+TEST_P(VectorTestFilled, Eytzinger)
+{
+    ZyanVector tree;
+    ASSERT_EQ(ZyanVectorInit(&tree, sizeof(ZyanU64), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+
+    // Use only even numbers to test lookups of missing elements as well
+    for (ZyanUSize i = 0; i < m_vector.size; ++i)
+    {
+        *static_cast<ZyanU64*>(ZyanVectorGetMutable(&m_vector, i)) = i * 2;
+    }
+    ASSERT_EQ(ZyanVectorBuildEytzinger(&tree, &m_vector), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(tree.size, m_vector.size + 1);
+
+    for (ZyanU64 i = 0; i < m_vector.size * 2 + 2; ++i)
+    {
+        ZyanUSize index;
+        const ZyanStatus status = ZyanVectorEytzingerSearch(&tree, &i, &index,
+            reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64));
+        const ZyanBool exists = !(i % 2) && (i < m_vector.size * 2);
+        EXPECT_EQ(status, exists ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE);
+        if (i >= m_vector.size * 2 - 1)
+        {
+            EXPECT_EQ(index, static_cast<ZyanUSize>(0));
+            continue;
+        }
+        ASSERT_NE(index, static_cast<ZyanUSize>(0));
+        EXPECT_EQ(ZYAN_VECTOR_GET(ZyanU64, &tree, index), (i + 1) & ~1ULL);
+    }
+
+    EXPECT_EQ(ZyanVectorDestroy(&tree), ZYAN_STATUS_SUCCESS);
+}
+
 TEST_P(VectorTestBase, Emplace)
 {
     ZyanU64* element_new;
@@ -488,6 +1155,70 @@ TEST_P(VectorTestBase, Emplace)
     EXPECT_EQ(ZYAN_VECTOR_GET(ZyanU64, &m_vector, 5), 1337);
 }
 
+TEST_P(VectorTestBase, EmplaceRange)
+{
+    ZyanU64* first;
+
+    EXPECT_EQ(ZyanVectorEmplaceRange(&m_vector, 0, 10, reinterpret_cast<void**>(&first)),
+        ZYAN_STATUS_SUCCESS);
+    for (ZyanU64 i = 0; i < 10; ++i)
+    {
+        first[i] = i;
+    }
+    EXPECT_EQ(m_vector.size, static_cast<ZyanUSize>(10));
+
+    // Opens a gap in the middle of the vector
+    EXPECT_EQ(ZyanVectorEmplaceRange(&m_vector, 5, 50, reinterpret_cast<void**>(&first)),
+        ZYAN_STATUS_SUCCESS);
+    for (ZyanU64 i = 0; i < 50; ++i)
+    {
+        first[i] = 1000 + i;
+    }
+    EXPECT_EQ(m_vector.size, static_cast<ZyanUSize>(60));
+
+    for (ZyanUSize i = 0; i < m_vector.size; ++i)
+    {
+        const ZyanU64 expected = (i < 5) ? i : ((i < 55) ? 1000 + i - 5 : i - 50);
+        EXPECT_EQ(ZYAN_VECTOR_GET(ZyanU64, &m_vector, i), expected);
+    }
+
+    EXPECT_EQ(ZyanVectorEmplaceRange(&m_vector, 61, 1, reinterpret_cast<void**>(&first)),
+        ZYAN_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(ZyanVectorEmplaceRange(&m_vector, 0, 0, reinterpret_cast<void**>(&first)),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
+TEST_P(VectorTestFilled, Typed)
+{
+    for (ZyanU64 i = 0; i < m_vector.size; ++i)
+    {
+        ASSERT_EQ(*VectorU64Get(&m_vector, i), i);
+    }
+
+    const ZyanU64 value = 1337;
+    EXPECT_EQ(VectorU64Set(&m_vector, 10, &value), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(VectorU64Set(&m_vector, m_vector.size, &value), ZYAN_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(ZYAN_VECTOR_GET(ZyanU64, &m_vector, 10), value);
+    *VectorU64GetMutable(&m_vector, 10) = 10;
+
+    ZyanISize index;
+    EXPECT_EQ(VectorU64Find(&m_vector, &value, &index,
+        reinterpret_cast<ZyanEqualityComparison>(&ZyanEqualsNumeric64)), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(index, -1);
+
+    // Pushing beyond the capacity falls back to the generic implementation
+    const ZyanStatus status = VectorU64PushBack(&m_vector, &value);
+    if (m_has_fixed_capacity)
+    {
+        EXPECT_EQ(status, ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+        return;
+    }
+    EXPECT_EQ(status, ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(VectorU64Find(&m_vector, &value, &index,
+        reinterpret_cast<ZyanEqualityComparison>(&ZyanEqualsNumeric64)), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(index, static_cast<ZyanISize>(m_test_size));
+}
+
 TEST_P(VectorTestFilled, SwapElements)
 {
     EXPECT_EQ(m_vector.capacity, m_vector.size);